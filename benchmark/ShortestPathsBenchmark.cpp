@@ -0,0 +1,55 @@
+#include <filesystem>
+#include <format>
+#include <Graphs/Benchmark.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Deserializer.hpp>
+#include <Graphs/ShortestPaths.hpp>
+#include <iostream>
+#include <memory>
+
+/*  Compares sequential Dijkstra on each of its priority queues with delta-stepping on the SSP_test size sweep,
+    along with the all-pairs distance matrix by tiled Floyd-Warshall.
+    Usage: ShortestPathsBenchmark [samples directory] [threads count]
+*/
+int main(int argc, char* argv[])
+{
+    using namespace Graphs;
+    using namespace Graphs::Algorithm;
+
+    constexpr uint32_t smallestGraph = 10;
+    constexpr uint32_t largestGraph = 300;
+    constexpr uint32_t sizeStep = 2;
+    constexpr NodeId sourceNode = 1;
+
+    std::filesystem::path samplesDirectory = argc > 1 ? argv[1] : "BenchmarkSamples/SSP_test";
+    uint32_t threadsCount = argc > 2 ? std::stoul(argv[2]) : ThreadPool::defaultThreadsCount();
+
+    auto result = std::make_shared<ShortestPathsResult>();
+    Dijkstra<notVerbose> binaryHeapDijkstra(result, sourceNode, std::cout, PriorityQueueType::binaryHeap);
+    Dijkstra<notVerbose> pairingHeapDijkstra(result, sourceNode, std::cout, PriorityQueueType::pairingHeap);
+    Dijkstra<notVerbose> radixHeapDijkstra(result, sourceNode, std::cout, PriorityQueueType::radixHeap);
+    DeltaStepping<notVerbose> deltaStepping(result, sourceNode, std::cout, 0, threadsCount);
+    FloydWarshall<notVerbose> floydWarshall(std::make_shared<DistanceMatrix>(), std::cout, false, threadsCount);
+
+    Benchmark benchmark;
+    for (auto size = smallestGraph; size <= largestGraph; size += sizeStep)
+    {
+        auto path = samplesDirectory / std::format("graph_{}.mat", size);
+        if (not std::filesystem::exists(path))
+        {
+            std::cerr << std::format("Skipping missing sample {}\n", path.string());
+            continue;
+        }
+
+        auto graph = Deserializer<CsrGraph<GraphDirectionality::directed>>::loadMatFile(path);
+        benchmark.run(graph,
+                      path.filename().string(),
+                      std::cout,
+                      {&binaryHeapDijkstra,
+                       &pairingHeapDijkstra,
+                       &radixHeapDijkstra,
+                       &deltaStepping,
+                       &floydWarshall});
+    }
+    return 0;
+}
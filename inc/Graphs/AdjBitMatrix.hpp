@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Graphs/DegreeTable.hpp>
+#include <Graphs/Graph.hpp>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Graphs
+{
+template <typename T>
+struct CacheLineAllocator
+{
+    using value_type = T;
+    static constexpr std::size_t cacheLineSize = 64;
+
+    CacheLineAllocator() = default;
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U>&)
+    {}
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{cacheLineSize}));
+    }
+
+    void deallocate(T* pointer, std::size_t)
+    {
+        ::operator delete(pointer, std::align_val_t{cacheLineSize});
+    }
+
+    template <typename U>
+    bool operator==(const CacheLineAllocator<U>&) const
+    {
+        return true;
+    }
+};
+
+/*  Adjacency matrix keeping a single bit per cell. Rows are padded to whole
+    cache lines, so word-wise kernels can run over them without tail handling.
+    Edge weights other than the default weight of 1 live in a separate sparse store.
+*/
+template <GraphDirectionality directionality>
+class AdjBitMatrix : public Graph
+{
+public:
+    AdjBitMatrix() = default;
+
+    AdjBitMatrix(AdjBitMatrix&) = default;
+    AdjBitMatrix(AdjBitMatrix&&) = default;
+
+    uint32_t nodesAmount() const override;
+    uint32_t getIncommingDegree(NodeId) const override;
+    uint32_t getOutgoingDegree(NodeId) const override;
+    uint32_t degreeOf(NodeId) const override;
+    uint32_t graphDegree() const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getOutgoingNeighborsOf(NodeId) const override;
+    std::vector<NodeId> getIncommingNeighborsOf(NodeId) const override;
+    std::vector<EdgeInfo> getEdges() const override;
+
+    void forEachNode(NodeVisitor) const override;
+    void forEachOutgoingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachIncommingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachOutgoingEdge(NodeId, EdgeVisitor) const override;
+    void forEachNeighbor(NodeId, NodeVisitor) const override;
+
+    uint32_t countCommonNeighbors(NodeId, NodeId) const;
+    std::vector<NodeId> getCommonNeighborsOf(NodeId, NodeId) const;
+    std::vector<NodeId> getNeighborhoodUnionOf(NodeId, NodeId) const;
+
+    void reset() override;
+
+    GraphDirectionality getDirectionality() const override;
+
+    virtual ~AdjBitMatrix() = default;
+
+    static constexpr GraphDirectionality Directionality = directionality;
+
+private:
+    using Word = uint64_t;
+    using Bits = std::vector<Word, CacheLineAllocator<Word>>;
+
+    static constexpr uint32_t bitsPerWord = 64;
+    static constexpr uint32_t wordsPerCacheLine = CacheLineAllocator<Word>::cacheLineSize / sizeof(Word);
+
+    std::string show() const override;
+
+    void resizeToFitNodes(uint32_t);
+    void visitBits(const Word*, NodeVisitor) const;
+    void reportEdge(uint32_t, uint32_t, void (DegreeTable::*)(uint32_t, uint32_t));
+    const Word* outgoingRow(uint32_t) const;
+    const Word* incommingRow(uint32_t) const;
+    Word* outgoingRow(uint32_t);
+    Word* incommingRow(uint32_t);
+
+    static uint64_t weightKey(NodeId, NodeId);
+
+    NodeIndexMapping nodeIndexMapping = {};
+    DegreeTable degrees = {};
+    uint32_t wordsPerRow = 0;
+    Bits bits = {};
+    Bits transposedBits = {};
+    std::unordered_map<uint64_t, WeightType> weights = {};
+};
+
+template class AdjBitMatrix<GraphDirectionality::undirected>;
+template class AdjBitMatrix<GraphDirectionality::directed>;
+} // namespace Graphs
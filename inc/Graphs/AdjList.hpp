@@ -1,7 +1,8 @@
 #pragma once
 
+#include <Graphs/DegreeTable.hpp>
 #include <Graphs/Graph.hpp>
-#include <map>
+#include <Graphs/NodeIndexMapping.hpp>
 #include <string>
 
 namespace Graphs
@@ -18,9 +19,12 @@ public:
     uint32_t nodesAmount() const override;
     uint32_t getIncommingDegree(NodeId) const override;
     uint32_t getOutgoingDegree(NodeId) const override;
+    uint32_t degreeOf(NodeId) const override;
+    uint32_t graphDegree() const override;
     EdgeInfo findEdge(const EdgeInfo&) const override;
 
     void setEdge(const EdgeInfo&) override;
+    void setEdges(const std::vector<EdgeInfo>&) override;
     void addNodes(uint32_t) override;
     void removeNode(NodeId) override;
     void removeEdge(const EdgeInfo&) override;
@@ -29,6 +33,12 @@ public:
     std::vector<NodeId> getIncommingNeighborsOf(NodeId) const override;
     std::vector<EdgeInfo> getEdges() const override;
 
+    void forEachNode(NodeVisitor) const override;
+    void forEachOutgoingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachIncommingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachOutgoingEdge(NodeId, EdgeVisitor) const override;
+    void forEachNeighbor(NodeId, NodeVisitor) const override;
+
     void reset() override;
 
     GraphDirectionality getDirectionality() const override;
@@ -43,10 +53,14 @@ private:
     using Neighbors = std::vector<EdgeInfo>;
 
     void removeNeighborFromRange(Neighbors&, EdgeInfo);
-    void addNeighborAndSortRange(Neighbors&, EdgeInfo);
+    bool addNeighborAndSortRange(Neighbors&, EdgeInfo);
 
     std::vector<Neighbors> nodes;
-    std::map<NodeId, uint32_t> nodeMap;
+    // Sorted in-edge sources of every node, kept only for directed graphs.
+    // Undirected rows are symmetric, so they serve as their own reverse.
+    std::vector<std::vector<NodeId>> incommingNodes;
+    NodeIndexMapping nodeIndexMapping;
+    DegreeTable degrees;
 };
 template class AdjList<GraphDirectionality::undirected>;
 template class AdjList<GraphDirectionality::directed>;
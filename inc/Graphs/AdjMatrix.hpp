@@ -1,13 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <Graphs/DegreeTable.hpp>
 #include <Graphs/Graph.hpp>
-#include <map>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace Graphs
 {
+/*  Adjacency matrix kept in a single row-major buffer. The row stride is the
+    node capacity and grows geometrically, so adding nodes in batches does not
+    re-layout the buffer each time. Directed graphs build a transposed copy on
+    the first column scan, so repeated column scans read contiguous memory as
+    well. Any mutation drops the copy, so graphs never scanned by columns do
+    not pay for it.
+*/
 template <GraphDirectionality directionality>
 class AdjMatrix : public Graph
 {
@@ -21,9 +31,12 @@ public:
     uint32_t nodesAmount() const override;
     uint32_t getIncommingDegree(NodeId) const override;
     uint32_t getOutgoingDegree(NodeId) const override;
+    uint32_t degreeOf(NodeId) const override;
+    uint32_t graphDegree() const override;
     EdgeInfo findEdge(const EdgeInfo&) const override;
 
     void setEdge(const EdgeInfo&) override;
+    void setEdges(const std::vector<EdgeInfo>&) override;
     void addNodes(uint32_t) override;
     void removeNode(NodeId) override;
     void removeEdge(const EdgeInfo&) override;
@@ -32,6 +45,12 @@ public:
     std::vector<NodeId> getIncommingNeighborsOf(NodeId) const override;
     std::vector<EdgeInfo> getEdges() const override;
 
+    void forEachNode(NodeVisitor) const override;
+    void forEachOutgoingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachIncommingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachOutgoingEdge(NodeId, EdgeVisitor) const override;
+    void forEachNeighbor(NodeId, NodeVisitor) const override;
+
     void reset() override;
 
     GraphDirectionality getDirectionality() const override;
@@ -43,11 +62,34 @@ public:
 private:
     std::string show() const override;
     void resizeMatrixToFitNodes(uint32_t);
+    void removeFromCells(std::vector<WeightType>&, uint32_t) const;
+    void reportEdge(uint32_t, uint32_t, void (DegreeTable::*)(uint32_t, uint32_t));
+    const WeightType* outgoingRow(uint32_t) const;
+    const WeightType* incommingRow(uint32_t) const;
+    void dropTransposedCells();
+    void storeEdge(const EdgeInfo&);
+
+    // Copies start out invalid, so a copied graph transposes its own cells when needed.
+    struct TransposedCells
+    {
+        TransposedCells() = default;
+        TransposedCells(const TransposedCells&) {}
+        TransposedCells& operator=(const TransposedCells&)
+        {
+            isValid = false;
+            return *this;
+        }
 
-    using Row = std::vector<WeightType>;
+        std::vector<WeightType> cells = {};
+        std::atomic<bool> isValid = false;
+        std::mutex mutex = {};
+    };
 
-    std::map<NodeId, uint32_t> nodeIndexMapping = {};
-    std::vector<Row> matrix = {};
+    NodeIndexMapping nodeIndexMapping = {};
+    DegreeTable degrees = {};
+    uint32_t stride = 0;
+    std::vector<WeightType> cells = {};
+    mutable TransposedCells transposedCells = {};
 };
 
 template class AdjMatrix<GraphDirectionality::undirected>;
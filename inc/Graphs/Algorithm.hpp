@@ -8,7 +8,7 @@ class AlgorithmFunctor
 {
 public:
     virtual std::string getName() = 0;
-    virtual void operator()(const Graphs::Graph&) = 0;
+    virtual void operator()(const Graphs::GraphReader&) = 0;
     virtual ~AlgorithmFunctor() = default;
 };
 
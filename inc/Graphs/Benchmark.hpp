@@ -6,7 +6,7 @@
 
 namespace Graphs
 {
-class Graph;
+class GraphReader;
 
 namespace Algorithm
 {
@@ -17,7 +17,10 @@ public:
     Benchmark(Benchmark&) = delete;
     Benchmark(Benchmark&&) = delete;
 
-    void run(Graphs::Graph& graph, std::string identifier, std::ostream& out, AlgorithmsCollection algorithms);
+    void run(const Graphs::GraphReader& graph,
+             std::string identifier,
+             std::ostream& out,
+             AlgorithmsCollection algorithms);
 
     ~Benchmark() {}
 };
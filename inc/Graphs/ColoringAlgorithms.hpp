@@ -1,10 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <Graphs/Algorithm.hpp>
 #include <Graphs/Graph.hpp>
+#include <Graphs/ThreadPool.hpp>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -14,7 +17,26 @@ namespace Graphs::Algorithm
 using ColorId = uint32_t;
 using ColoringInfo = std::pair<NodeId, ColorId>;
 using ColoringVector = std::vector<ColoringInfo>;
+// Highest color used, with colors numbered from 0, and the coloring itself.
 using ColoringResult = std::tuple<ColorId, ColoringVector>;
+// Lower bound on the chromatic number, colors used by the best coloring found and the coloring itself.
+// Both counts are equal once the coloring is proven optimal.
+using ChromaticNumberResult = std::tuple<uint32_t, uint32_t, ColoringVector>;
+
+// Order in which coloring algorithms accepting an ordering visit the nodes.
+enum class NodeOrdering
+{
+    natural,
+    largestFirst,
+    smallestLast
+};
+
+// Limits of an exact search. Once either is exceeded, the best solution found so far is returned.
+struct SearchBudget
+{
+    uint64_t maxBranches = std::numeric_limits<uint64_t>::max();
+    std::chrono::milliseconds timeLimit = std::chrono::milliseconds::max();
+};
 
 template <bool isVerbose>
 class GreedyColoring : public AlgorithmFunctor
@@ -31,7 +53,7 @@ public:
 
     std::string getName() override;
 
-    void operator()(const Graphs::Graph&) override;
+    void operator()(const Graphs::GraphReader&) override;
 
 private:
     std::shared_ptr<ColoringResult> result = {};
@@ -53,7 +75,7 @@ public:
 
     std::string getName() override;
 
-    void operator()(const Graphs::Graph&) override;
+    void operator()(const Graphs::GraphReader&) override;
 
 private:
     std::shared_ptr<ColoringResult> result = {};
@@ -75,10 +97,135 @@ public:
 
     std::string getName() override;
 
-    void operator()(const Graphs::Graph&) override;
+    void operator()(const Graphs::GraphReader&) override;
 
 private:
     std::shared_ptr<ColoringResult> result = {};
     [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
 };
+
+/*  DSatur coloring. Nodes are colored one by one, each time picking the uncolored
+    node with the most distinct colors among its neighbors, then the one of the
+    highest degree. An indexed heap keeps the candidates ordered, so the coloring
+    runs in O((V + E) log V).
+*/
+template <bool isVerbose>
+class DSaturColoring : public AlgorithmFunctor
+{
+public:
+    explicit DSaturColoring(std::shared_ptr<ColoringResult> resultContainer, std::ostream& out = std::cout);
+
+    DSaturColoring() = delete;
+    DSaturColoring(const DSaturColoring&) = delete;
+    DSaturColoring(DSaturColoring&&) = delete;
+
+    DSaturColoring& operator=(const DSaturColoring&) = delete;
+    DSaturColoring& operator=(DSaturColoring&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ColoringResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+};
+
+/*  Jones-Plassmann coloring. Every node gets a random priority; in each round the
+    uncolored nodes whose priority beats all their uncolored neighbors form an
+    independent set, which is colored in parallel with the smallest colors free
+    among already colored neighbors. The seed makes the coloring reproducible.
+*/
+template <bool isVerbose>
+class ParallelColoring : public AlgorithmFunctor
+{
+public:
+    explicit ParallelColoring(std::shared_ptr<ColoringResult> resultContainer,
+                              std::ostream& out = std::cout,
+                              uint32_t threadsCount = ThreadPool::defaultThreadsCount(),
+                              uint64_t seed = 0);
+
+    ParallelColoring() = delete;
+    ParallelColoring(const ParallelColoring&) = delete;
+    ParallelColoring(ParallelColoring&&) = delete;
+
+    ParallelColoring& operator=(const ParallelColoring&) = delete;
+    ParallelColoring& operator=(ParallelColoring&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ColoringResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    ThreadPool threadPool;
+    uint64_t seed = 0;
+};
+
+/*  Gebremedhin-Manne speculative coloring. Threads greedily color chunks of the
+    ordering concurrently, reading colors of neighbors colored at the same time.
+    A detection pass then finds adjacent nodes which got equal colors, and the
+    later of each pair in the ordering is recolored in the next round, until
+    no conflicts remain.
+*/
+template <bool isVerbose>
+class SpeculativeColoring : public AlgorithmFunctor
+{
+public:
+    explicit SpeculativeColoring(std::shared_ptr<ColoringResult> resultContainer,
+                                 std::ostream& out = std::cout,
+                                 NodeOrdering ordering = NodeOrdering::natural,
+                                 uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    SpeculativeColoring() = delete;
+    SpeculativeColoring(const SpeculativeColoring&) = delete;
+    SpeculativeColoring(SpeculativeColoring&&) = delete;
+
+    SpeculativeColoring& operator=(const SpeculativeColoring&) = delete;
+    SpeculativeColoring& operator=(SpeculativeColoring&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ColoringResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    ThreadPool threadPool;
+    NodeOrdering ordering = NodeOrdering::natural;
+};
+
+/*  Exact chromatic number by DSatur branch-and-bound. A greedy clique found with
+    bit-parallel neighborhood intersections gives the lower bound and precolors
+    the search root, LF and SL colorings give the initial upper bound. Subtrees
+    below the first levels of the search are explored by separate threads, which
+    share the best coloring found so far.
+*/
+template <bool isVerbose>
+class ChromaticNumber : public AlgorithmFunctor
+{
+public:
+    explicit ChromaticNumber(std::shared_ptr<ChromaticNumberResult> resultContainer,
+                             std::ostream& out = std::cout,
+                             SearchBudget budget = {},
+                             uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    ChromaticNumber() = delete;
+    ChromaticNumber(const ChromaticNumber&) = delete;
+    ChromaticNumber(ChromaticNumber&&) = delete;
+
+    ChromaticNumber& operator=(const ChromaticNumber&) = delete;
+    ChromaticNumber& operator=(ChromaticNumber&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ChromaticNumberResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    ThreadPool threadPool;
+    SearchBudget budget = {};
+};
 } // namespace Graphs::Algorithm
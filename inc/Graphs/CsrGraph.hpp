@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Graphs
+{
+template <GraphDirectionality directionality>
+class CsrGraph : public GraphReader
+{
+public:
+    CsrGraph() = default;
+    explicit CsrGraph(const GraphReader&);
+    CsrGraph(uint32_t nodesAmount, const std::vector<EdgeInfo>& edges);
+    // Adopts rows already in CSR form over nodes 1..offsets.size() - 1, with every row sorted by neighbor
+    // without repeats and undirected edges stored in both rows. Weights are either empty or given for all.
+    CsrGraph(std::vector<uint32_t> offsets, std::vector<NodeId> neighbors, std::vector<WeightType> weights);
+
+    CsrGraph(const CsrGraph&) = default;
+    CsrGraph(CsrGraph&&) = default;
+
+    CsrGraph& operator=(const CsrGraph&) = default;
+    CsrGraph& operator=(CsrGraph&&) = default;
+
+    uint32_t nodesAmount() const override;
+    uint32_t getIncommingDegree(NodeId) const override;
+    uint32_t getOutgoingDegree(NodeId) const override;
+    uint32_t degreeOf(NodeId) const override;
+    uint32_t graphDegree() const override;
+    EdgeInfo findEdge(const EdgeInfo&) const override;
+
+    std::vector<NodeId> getNodeIds() const override;
+    std::vector<NodeId> getOutgoingNeighborsOf(NodeId) const override;
+    std::vector<NodeId> getIncommingNeighborsOf(NodeId) const override;
+    std::vector<NodeId> getNeighborsOf(NodeId) const override;
+    std::vector<EdgeInfo> getEdges() const override;
+
+    void forEachNode(NodeVisitor) const override;
+    void forEachOutgoingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachIncommingNeighbor(NodeId, NodeVisitor) const override;
+    void forEachOutgoingEdge(NodeId, EdgeVisitor) const override;
+    void forEachNeighbor(NodeId, NodeVisitor) const override;
+
+    std::span<const NodeId> getOutgoingNeighborsView(NodeId) const;
+    std::span<const NodeId> getIncommingNeighborsView(NodeId) const;
+
+    GraphDirectionality getDirectionality() const override;
+
+    virtual ~CsrGraph() = default;
+
+    static constexpr GraphDirectionality Directionality = directionality;
+
+private:
+    std::string show() const override;
+
+    void build(std::vector<NodeId> ids, const std::vector<EdgeInfo>& edges);
+    void buildIncommingRows();
+    void computeGraphDegree();
+
+    NodeIndexMapping nodeIndexMapping = {};
+    std::vector<uint32_t> offsets = {0};
+    std::vector<NodeId> neighbors = {};
+    std::vector<WeightType> weights = {};
+    std::vector<uint32_t> incommingOffsets = {0};
+    std::vector<NodeId> incommingNeighbors = {};
+    uint32_t maxDegree = 0;
+};
+
+template class CsrGraph<GraphDirectionality::undirected>;
+template class CsrGraph<GraphDirectionality::directed>;
+} // namespace Graphs
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Graphs
+{
+/*  Per-node incomming and outgoing edge counters, indexed by dense node index.
+    A histogram of node degrees - the larger of both counters - keeps the
+    maximum degree current, so the graph degree never needs a full scan.
+    Owning representations report every stored edge; an undirected edge is
+    reported once in each direction.
+*/
+class DegreeTable
+{
+public:
+    uint32_t incommingDegreeOf(uint32_t index) const
+    {
+        return incomming[index];
+    }
+
+    uint32_t outgoingDegreeOf(uint32_t index) const
+    {
+        return outgoing[index];
+    }
+
+    uint32_t degreeOf(uint32_t index) const
+    {
+        return incomming[index] > outgoing[index] ? incomming[index] : outgoing[index];
+    }
+
+    uint32_t maxDegree() const
+    {
+        return highestDegree;
+    }
+
+    void addNodes(uint32_t);
+    // Drops the counters of a node. Its edges must be reported as removed beforehand, so the neighbors are updated.
+    void removeNode(uint32_t index);
+    void edgeAdded(uint32_t sourceIndex, uint32_t destinationIndex);
+    void edgeRemoved(uint32_t sourceIndex, uint32_t destinationIndex);
+    void clear();
+
+private:
+    template <typename Update>
+    void updateNode(uint32_t index, Update update);
+
+    std::vector<uint32_t> incomming = {};
+    std::vector<uint32_t> outgoing = {};
+    std::vector<uint32_t> nodesWithDegree = {};
+    uint32_t highestDegree = 0;
+};
+} // namespace Graphs
@@ -1,25 +1,49 @@
 #pragma once
 
+#include <Graphs/AdjBitMatrix.hpp>
 #include <Graphs/AdjList.hpp>
 #include <Graphs/AdjMatrix.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/ThreadPool.hpp>
+#include <filesystem>
 #include <iosfwd>
 #include <type_traits>
 
 namespace Graphs
 {
-class Graph;
+class GraphReader;
 
-template <typename GraphType, typename Guard = std::enable_if_t<std::is_base_of_v<Graph, GraphType>>>
+template <typename GraphType, typename Guard = std::enable_if_t<std::is_base_of_v<GraphReader, GraphType>>>
 class Deserializer
 {
 public:
     static GraphType deserializeLstFile(std::istream&);
     static GraphType deserializeMatFile(std::istream&);
     static GraphType deserializeGraphMlFile(std::istream&);
+    static GraphType deserializeBinaryFile(std::istream&);
+
+    /*  Map the file read-only and parse it straight from the mapped pages, without
+        copying it. Lines of large .lst and .mat files are split into chunks parsed
+        by separate threads, and the graph is built once from all of their edges.
+    */
+    static GraphType loadLstFile(const std::filesystem::path&,
+                                 uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+    static GraphType loadMatFile(const std::filesystem::path&,
+                                 uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+    static GraphType loadGraphMlFile(const std::filesystem::path&);
+    /*  Snapshots need no parsing. After the header is checked against the file size,
+        each array is copied out of the mapping at once and its rows are validated.
+        CsrGraph adopts the arrays as they are, other representations add their edges.
+    */
+    static GraphType loadBinaryFile(const std::filesystem::path&);
 };
 
 template class Deserializer<AdjList<GraphDirectionality::undirected>>;
 template class Deserializer<AdjList<GraphDirectionality::directed>>;
 template class Deserializer<AdjMatrix<GraphDirectionality::undirected>>;
 template class Deserializer<AdjMatrix<GraphDirectionality::directed>>;
+template class Deserializer<AdjBitMatrix<GraphDirectionality::undirected>>;
+template class Deserializer<AdjBitMatrix<GraphDirectionality::directed>>;
+template class Deserializer<CsrGraph<GraphDirectionality::undirected>>;
+template class Deserializer<CsrGraph<GraphDirectionality::directed>>;
 } // namespace Graphs
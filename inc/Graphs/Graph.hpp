@@ -4,8 +4,10 @@
 #include <compare>
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <ranges>
+#include <type_traits>
 #include <vector>
 
 namespace Graphs
@@ -28,6 +30,39 @@ enum class GraphDirectionality
     undirected
 };
 
+/*  Non-owning reference to a callable invoked with a NodeId.
+    Unlike std::function it never allocates, so the visiting
+    functions below are safe to call in hot loops. The referenced
+    callable must outlive the visitor, which holds for the usual
+    case of passing a lambda directly to a forEach* call.
+*/
+template <typename... Args>
+class Visitor
+{
+public:
+    template <typename Callable,
+              typename = std::enable_if_t<not std::is_same_v<std::remove_cvref_t<Callable>, Visitor>>>
+    Visitor(Callable&& callable)
+        : object{const_cast<void*>(static_cast<const void*>(std::addressof(callable)))},
+          invoker{[](void* object, Args... args) {
+              (*static_cast<std::remove_reference_t<Callable>*>(object))(args...);
+          }}
+    {}
+
+    void operator()(Args... args) const
+    {
+        invoker(object, args...);
+    }
+
+private:
+    void* object;
+    void (*invoker)(void*, Args...);
+};
+
+using NodeVisitor = Visitor<NodeId>;
+// Invoked with the destination and the weight of an edge.
+using EdgeVisitor = Visitor<NodeId, WeightType>;
+
 class GraphReader
 {
 public:
@@ -46,16 +81,33 @@ public:
     virtual std::vector<NodeId> getIncommingNeighborsOf(NodeId) const = 0;
     virtual std::vector<EdgeInfo> getEdges() const = 0;
 
+    virtual void forEachNode(NodeVisitor) const = 0;
+    virtual void forEachOutgoingNeighbor(NodeId, NodeVisitor) const = 0;
+    virtual void forEachIncommingNeighbor(NodeId, NodeVisitor) const = 0;
+
+    // Visits outgoing edges of the node along with their weights. Representations storing the weights
+    // next to the neighbors override it, to avoid looking each edge up again.
+    virtual void forEachOutgoingEdge(NodeId node, EdgeVisitor visitor) const
+    {
+        forEachOutgoingNeighbor(node, [this, node, &visitor](NodeId neighbor) {
+            visitor(neighbor, findEdge({node, neighbor}).weight.value_or(1));
+        });
+    }
+
     virtual GraphDirectionality getDirectionality() const = 0;
 
+    // Larger of the incomming and outgoing degree of the node.
+    virtual uint32_t degreeOf(NodeId node) const
+    {
+        return std::max(getIncommingDegree(node), getOutgoingDegree(node));
+    }
+
     virtual uint32_t graphDegree() const
     {
         uint32_t graphDegree = 0;
-        for (auto node : getNodeIds())
-        {
-            auto maxNodeDegree = std::max(getIncommingDegree(node), getOutgoingDegree(node));
-            graphDegree = std::max(graphDegree, maxNodeDegree);
-        }
+        forEachNode([this, &graphDegree](NodeId node) {
+            graphDegree = std::max(graphDegree, degreeOf(node));
+        });
         return graphDegree;
     }
 
@@ -71,6 +123,22 @@ public:
         return neighbors;
     }
 
+    // Visits every node adjacent to the given one exactly once, in no particular order.
+    virtual void forEachNeighbor(NodeId node, NodeVisitor visitor) const
+    {
+        forEachOutgoingNeighbor(node, visitor);
+        if (getDirectionality() == GraphDirectionality::undirected)
+        {
+            return;
+        }
+        forEachIncommingNeighbor(node, [this, node, &visitor](NodeId neighbor) {
+            if (not findEdge({node, neighbor}).weight.has_value())
+            {
+                visitor(neighbor);
+            }
+        });
+    }
+
     auto operator<=>(const GraphReader& other) const
     {
         return compare(other);
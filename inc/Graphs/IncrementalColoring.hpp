@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/Graph.hpp>
+#include <limits>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+/*  Proper coloring kept up to date while the graph changes. Mutations have to go
+    through this object, which forwards them to the attached graph and repairs the
+    coloring locally: an edge joining two nodes of equal color recolors one of its
+    endpoints, and nodes losing a neighbor move to a smaller color if one became
+    free. Optionally, every given number of mutations the whole graph is colored
+    anew with DSatur, and the result is kept if it uses fewer colors.
+*/
+class IncrementalColoring : public GraphWriter
+{
+public:
+    static constexpr ColorId uncolored = std::numeric_limits<ColorId>::max();
+
+    explicit IncrementalColoring(Graph& graph, uint32_t reoptimizationPeriod = 0);
+
+    IncrementalColoring() = delete;
+    IncrementalColoring(const IncrementalColoring&) = delete;
+    IncrementalColoring(IncrementalColoring&&) = delete;
+
+    IncrementalColoring& operator=(const IncrementalColoring&) = delete;
+    IncrementalColoring& operator=(IncrementalColoring&&) = delete;
+
+    void setEdge(const EdgeInfo&) override;
+    void addNodes(uint32_t) override;
+    void removeNode(NodeId) override;
+    void removeEdge(const EdgeInfo&) override;
+    void reset() override;
+
+    // Colors the whole graph with DSatur and keeps the result if it uses fewer colors.
+    void reoptimize();
+
+    ColorId colorOf(NodeId node) const
+    {
+        return node < colors.size() ? colors[node] : uncolored;
+    }
+
+    // Number of distinct colors in use.
+    uint32_t colorsCount() const
+    {
+        return usedColorsCount;
+    }
+
+    // Highest color in use plus one. Exceeds colorsCount() while lowered colors leave gaps below it.
+    uint32_t colorsSpan() const
+    {
+        return static_cast<uint32_t>(nodesWithColor.size());
+    }
+
+    // Number of times a node changed its color since the attachment.
+    uint64_t recoloringsCount() const
+    {
+        return recolorings;
+    }
+
+    ColoringVector getColoring() const;
+
+private:
+    void assign(NodeId node, ColorId color);
+    ColorId firstFreeColor(NodeId node);
+    void resolveConflict(NodeId source, NodeId destination);
+    void lowerColor(NodeId node);
+    void mutationApplied();
+
+    Graph& graph;
+    uint32_t reoptimizationPeriod;
+    uint32_t mutationsSinceReoptimization = 0;
+    uint64_t recolorings = 0;
+    NodeId highestId = 0;
+    std::vector<ColorId> colors = {};
+    std::vector<uint32_t> nodesWithColor = {};
+    uint32_t usedColorsCount = 0;
+    std::vector<uint32_t> forbiddenStamps = {};
+    uint32_t stamp = 0;
+};
+} // namespace Graphs::Algorithm
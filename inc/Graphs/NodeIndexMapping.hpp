@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Graph.hpp>
+#include <limits>
+#include <vector>
+
+namespace Graphs
+{
+/*  Bidirectional mapping between node ids and dense indices [0, size).
+    Ids are kept in ascending order, so the index of a node is its position
+    among the ids. While the ids form the range 1..size the mapping is pure
+    arithmetic; once a removal leaves a gap, a flat id -> index table is kept.
+*/
+class NodeIndexMapping
+{
+public:
+    static constexpr uint32_t invalidIndex = std::numeric_limits<uint32_t>::max();
+
+    NodeIndexMapping() = default;
+    explicit NodeIndexMapping(std::vector<NodeId> sortedIds);
+
+    uint32_t indexOf(NodeId nodeId) const
+    {
+        if (contiguous)
+        {
+            return (nodeId != 0 and nodeId <= indexToId.size()) ? nodeId - 1 : invalidIndex;
+        }
+        return nodeId < idToIndex.size() ? idToIndex[nodeId] : invalidIndex;
+    }
+
+    NodeId idOf(uint32_t index) const
+    {
+        return indexToId[index];
+    }
+
+    bool contains(NodeId nodeId) const
+    {
+        return indexOf(nodeId) != invalidIndex;
+    }
+
+    uint32_t size() const
+    {
+        return static_cast<uint32_t>(indexToId.size());
+    }
+
+    bool empty() const
+    {
+        return indexToId.empty();
+    }
+
+    NodeId highestId() const
+    {
+        return indexToId.empty() ? 0 : indexToId.back();
+    }
+
+    const std::vector<NodeId>& ids() const
+    {
+        return indexToId;
+    }
+
+    void addNodes(uint32_t);
+    uint32_t removeNode(NodeId);
+    void clear();
+
+private:
+    void refreshLookupTable(uint32_t firstChangedIndex);
+
+    std::vector<NodeId> indexToId = {};
+    std::vector<uint32_t> idToIndex = {};
+    bool contiguous = true;
+};
+} // namespace Graphs
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <Graphs/Algorithm.hpp>
+#include <Graphs/Graph.hpp>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+using CoreNumbers = std::vector<std::pair<NodeId, uint32_t>>;
+using DegeneracyResult = std::tuple<Permutation, uint32_t, CoreNumbers>;
+
+// Order of nodes sharing the same degree in degree-based orderings.
+enum class TieBreak
+{
+    byId,
+    random,
+    incommingDegree
+};
+
+/*  Orders nodes by non-increasing degree, as returned by GraphReader::degreeOf.
+    Nodes of equal degree are ordered by ascending id, randomly using the given
+    seed, or by non-increasing incomming degree with ascending id after that.
+    Runs in O(V + maximal degree) on top of the degree queries.
+*/
+Permutation largestFirstOrdering(const GraphReader&, TieBreak = TieBreak::byId, uint64_t seed = 0);
+
+/*  Smallest-last ordering: nodes of minimal degree are removed one by one and
+    the ordering is the reverse of the removal order. Degrees are counted in the
+    graph with edge directions ignored. Uses the Matula-Beck bucket queue, so it
+    runs in O(V + E) and yields the degeneracy of the graph and the core number
+    of every node, listed in ascending id order, as a by-product.
+*/
+DegeneracyResult smallestLastOrdering(const GraphReader&);
+} // namespace Graphs::Algorithm
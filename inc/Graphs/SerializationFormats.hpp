@@ -1,11 +1,40 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 namespace Graphs
 {
 enum class FileType
 {
     LST,
     MAT,
-    GRAPHML
+    GRAPHML,
+    BINARY
+};
+
+/*  Header opening FileType::BINARY snapshots, stored little-endian. It is followed by
+    the graph in CSR form over nodes 1..nodesCount: nodesCount + 1 row offsets, then
+    edgesCount neighbor ids sorted within each row, then edgesCount weights when the
+    graph is weighted. Offsets, neighbor ids and weights are all 32-bit, and every
+    array starts at a multiple of 8 bytes. Loading copies each array out of the file
+    once and validates the rows; there is no text to parse.
+*/
+struct BinaryFileHeader
+{
+    static constexpr std::array<char, 8> expectedMagic = {'G', 'R', 'A', 'P', 'H', 'C', 'A', 'K'};
+    static constexpr uint32_t currentVersion = 1;
+    static constexpr uint32_t arraysAlignment = 8;
+
+    std::array<char, 8> magic = expectedMagic;
+    uint32_t version = currentVersion;
+    uint8_t directionality = 0; // 0 for undirected graphs, 1 for directed ones
+    uint8_t isWeighted = 0;
+    uint16_t reserved = 0;
+    uint64_t nodesCount = 0;
+    // Amount of stored neighbor ids; an undirected edge is stored in the rows of both its ends, a loop once.
+    uint64_t edgesCount = 0;
 };
+
+static_assert(sizeof(BinaryFileHeader) == 32 and sizeof(BinaryFileHeader) % BinaryFileHeader::arraysAlignment == 0);
 } // namespace Graphs
@@ -6,6 +6,7 @@
 namespace Graphs
 {
 class Graph;
+class GraphReader;
 
 class Serializer
 {
@@ -13,5 +14,7 @@ public:
     static void serializeLstFile(std::ostream&, const Graph&);
     static void serializeMatFile(std::ostream&, const Graph&);
     static void serializeGraphMlFile(std::ostream&, const Graph&);
+    // Accepts any representation, so immutable graphs such as CsrGraph can be snapshotted as well.
+    static void serializeBinaryFile(std::ostream&, const GraphReader&);
 };
 } // namespace Graphs
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <Graphs/Algorithm.hpp>
+#include <Graphs/Graph.hpp>
+#include <Graphs/ThreadPool.hpp>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace Graphs::Algorithm
+{
+using Distance = int64_t;
+// Node, its distance from the source and its predecessor on a shortest path.
+using PathInfo = std::tuple<NodeId, Distance, NodeId>;
+using ShortestPathsVector = std::vector<PathInfo>;
+// Source node and the path information of every node, in ascending order of ids.
+using ShortestPathsResult = std::tuple<NodeId, ShortestPathsVector>;
+
+// Nodes of a negative cycle, each one followed by the destination of its edge on the cycle.
+using NegativeCycle = std::vector<NodeId>;
+
+constexpr Distance unreachable = std::numeric_limits<Distance>::max();
+constexpr NodeId noPredecessor = 0;
+
+/*  Shortest distances between all pairs of nodes, stored row by row over the nodes
+    in ascending order of ids. When paths are reconstructed, next hops hold for
+    every pair the index of the node following the source on a shortest path.
+*/
+struct DistanceMatrix
+{
+    std::vector<NodeId> nodes;
+    std::vector<Distance> distances;
+    std::vector<uint32_t> nextHops;
+
+    // Unreachable also when either node is missing.
+    Distance distance(NodeId source, NodeId destination) const;
+    // Nodes of a shortest path including both ends; empty when unreachable or paths were not reconstructed.
+    std::vector<NodeId> path(NodeId source, NodeId destination) const;
+};
+
+using HopCount = uint32_t;
+constexpr HopCount unreachableHops = std::numeric_limits<HopCount>::max();
+
+/*  Numbers of edges on the shortest paths from every source, one row per source
+    over the nodes in ascending order of ids.
+*/
+struct HopMatrix
+{
+    std::vector<NodeId> sources;
+    std::vector<NodeId> nodes;
+    std::vector<HopCount> hops;
+
+    // Unreachable also when the source was not searched from or the destination is missing.
+    HopCount hopsBetween(NodeId source, NodeId destination) const;
+};
+
+// Priority queue ordering the nodes waiting to be settled by Dijkstra's algorithm.
+enum class PriorityQueueType
+{
+    binaryHeap,
+    pairingHeap,
+    radixHeap
+};
+
+// Way in which the Bellman-Ford algorithm relaxes the edges.
+enum class RelaxationMode
+{
+    queue,
+    parallelRounds
+};
+
+/*  Dijkstra's single-source shortest paths for non-negative edge weights. The
+    binary heap keeps stale entries instead of decreasing keys, the pairing heap
+    decreases them in place, and the radix heap exploits the popped distances
+    never decreasing, with buckets by the highest bit differing from the last one.
+*/
+template <bool isVerbose>
+class Dijkstra : public AlgorithmFunctor
+{
+public:
+    explicit Dijkstra(std::shared_ptr<ShortestPathsResult> resultContainer,
+                      NodeId source,
+                      std::ostream& out = std::cout,
+                      PriorityQueueType queueType = PriorityQueueType::binaryHeap);
+
+    Dijkstra() = delete;
+    Dijkstra(const Dijkstra&) = delete;
+    Dijkstra(Dijkstra&&) = delete;
+
+    Dijkstra& operator=(const Dijkstra&) = delete;
+    Dijkstra& operator=(Dijkstra&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ShortestPathsResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    NodeId source = noPredecessor;
+    PriorityQueueType queueType = PriorityQueueType::binaryHeap;
+};
+
+/*  Bellman-Ford single-source shortest paths, allowing negative edge weights.
+    The queue mode (SPFA) only relaxes edges of nodes whose distance changed and
+    stops once the queue runs empty. The parallel mode relaxes edges in rounds,
+    each node pulling distances of its changed incomming neighbors, so threads
+    never write the same node. When a negative cycle is reachable from the source,
+    it is stored in the cycle container and the paths result is left untouched;
+    otherwise the cycle container is cleared. The queue mode runs in the calling
+    thread, so only the parallel mode starts worker threads.
+*/
+template <bool isVerbose>
+class BellmanFord : public AlgorithmFunctor
+{
+public:
+    explicit BellmanFord(std::shared_ptr<ShortestPathsResult> resultContainer,
+                         std::shared_ptr<NegativeCycle> negativeCycleContainer,
+                         NodeId source,
+                         std::ostream& out = std::cout,
+                         RelaxationMode mode = RelaxationMode::queue,
+                         uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    BellmanFord() = delete;
+    BellmanFord(const BellmanFord&) = delete;
+    BellmanFord(BellmanFord&&) = delete;
+
+    BellmanFord& operator=(const BellmanFord&) = delete;
+    BellmanFord& operator=(BellmanFord&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ShortestPathsResult> result = {};
+    std::shared_ptr<NegativeCycle> negativeCycle = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    NodeId source = noPredecessor;
+    RelaxationMode mode = RelaxationMode::queue;
+    ThreadPool threadPool;
+};
+
+/*  Delta-stepping parallel single-source shortest paths for non-negative weights.
+    Nodes wait in buckets of distances delta wide. Nodes of the lowest bucket relax
+    their light edges, of weights up to delta, in parallel phases until the bucket
+    stays empty, and then their heavy edges once. Distances are lowered with atomic
+    compare-and-swap. A delta of 0 picks the largest weight divided by the average
+    outgoing degree.
+*/
+template <bool isVerbose>
+class DeltaStepping : public AlgorithmFunctor
+{
+public:
+    explicit DeltaStepping(std::shared_ptr<ShortestPathsResult> resultContainer,
+                           NodeId source,
+                           std::ostream& out = std::cout,
+                           Distance delta = 0,
+                           uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    DeltaStepping() = delete;
+    DeltaStepping(const DeltaStepping&) = delete;
+    DeltaStepping(DeltaStepping&&) = delete;
+
+    DeltaStepping& operator=(const DeltaStepping&) = delete;
+    DeltaStepping& operator=(DeltaStepping&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<ShortestPathsResult> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    NodeId source = noPredecessor;
+    Distance delta = 0;
+    ThreadPool threadPool;
+};
+
+/*  Floyd-Warshall all-pairs shortest paths over a flat copy of the weight matrix,
+    split into square tiles small enough to stay in cache. Every round settles the
+    diagonal tile of the next block of pivots, then the tiles sharing its row or
+    column, and finally all the remaining tiles, with the tiles of each of the two
+    last steps relaxed in parallel. Negative weights are allowed; when a negative
+    cycle appears, the result is cleared.
+*/
+template <bool isVerbose>
+class FloydWarshall : public AlgorithmFunctor
+{
+public:
+    explicit FloydWarshall(std::shared_ptr<DistanceMatrix> resultContainer,
+                           std::ostream& out = std::cout,
+                           bool reconstructPaths = false,
+                           uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    FloydWarshall() = delete;
+    FloydWarshall(const FloydWarshall&) = delete;
+    FloydWarshall(FloydWarshall&&) = delete;
+
+    FloydWarshall& operator=(const FloydWarshall&) = delete;
+    FloydWarshall& operator=(FloydWarshall&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<DistanceMatrix> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    bool reconstructPaths = false;
+    ThreadPool threadPool;
+};
+
+/*  Multi-source BFS: breadth-first searches from up to 256 sources share a single
+    pass over the edges. Every node keeps bitmasks of the searches which have seen
+    it and which visit it in the current level, and pulls the visiting masks of its
+    incomming neighbors in parallel. Sources go in batches of 64, or of 256 when
+    there are more of them. CSR graphs are traversed in place; other representations
+    are copied into a compact adjacency first. No sources means every node.
+*/
+template <bool isVerbose>
+class MultiSourceBfs : public AlgorithmFunctor
+{
+public:
+    explicit MultiSourceBfs(std::shared_ptr<HopMatrix> resultContainer,
+                            std::vector<NodeId> sources = {},
+                            std::ostream& out = std::cout,
+                            uint32_t threadsCount = ThreadPool::defaultThreadsCount());
+
+    MultiSourceBfs() = delete;
+    MultiSourceBfs(const MultiSourceBfs&) = delete;
+    MultiSourceBfs(MultiSourceBfs&&) = delete;
+
+    MultiSourceBfs& operator=(const MultiSourceBfs&) = delete;
+    MultiSourceBfs& operator=(MultiSourceBfs&&) = delete;
+
+    std::string getName() override;
+
+    void operator()(const Graphs::GraphReader&) override;
+
+private:
+    std::shared_ptr<HopMatrix> result = {};
+    [[maybe_unused]] std::unique_ptr<std::ostream, std::function<void(std::ostream*)>> outStream = {};
+    std::vector<NodeId> sources = {};
+    ThreadPool threadPool;
+};
+} // namespace Graphs::Algorithm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Graphs
+{
+/*  Fixed-size pool of worker threads for data-parallel loops. A pool of size n
+    runs n - 1 workers, as the thread calling parallelFor takes part in the work.
+*/
+class ThreadPool
+{
+public:
+    using RangeBody = std::function<void(uint32_t begin, uint32_t end)>;
+
+    static uint32_t defaultThreadsCount();
+
+    explicit ThreadPool(uint32_t threadsCount = defaultThreadsCount());
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    ~ThreadPool();
+
+    uint32_t size() const;
+
+    /*  Splits [0, count) into chunks handed out dynamically to all threads of the
+        pool and returns once every chunk is processed. The first exception thrown
+        by the body is rethrown in the calling thread. The body must not call
+        parallelFor of the same pool.
+    */
+    void parallelFor(uint32_t count, const RangeBody& body);
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> workers = {};
+    std::deque<std::function<void()>> tasks = {};
+    std::mutex tasksMutex = {};
+    std::condition_variable tasksAvailable = {};
+    bool stopping = false;
+};
+} // namespace Graphs
@@ -0,0 +1,570 @@
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <Graphs/AdjBitMatrix.hpp>
+#include <sstream>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+using Word = uint64_t;
+
+template <bool isIntersection>
+Word combineWords(Word lhs, Word rhs)
+{
+    return isIntersection ? (lhs & rhs) : (lhs | rhs);
+}
+
+template <bool isIntersection>
+void combineRows(const Word* lhs, const Word* rhs, Word* out, uint32_t words)
+{
+    uint32_t idx = 0;
+#if defined(__AVX2__)
+    for (; idx + 4 <= words; idx += 4)
+    {
+        auto lhsChunk = _mm256_load_si256(reinterpret_cast<const __m256i*>(lhs + idx));
+        auto rhsChunk = _mm256_load_si256(reinterpret_cast<const __m256i*>(rhs + idx));
+        auto result
+            = isIntersection ? _mm256_and_si256(lhsChunk, rhsChunk) : _mm256_or_si256(lhsChunk, rhsChunk);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(out + idx), result);
+    }
+#endif
+    for (; idx < words; idx++)
+    {
+        out[idx] = combineWords<isIntersection>(lhs[idx], rhs[idx]);
+    }
+}
+
+// Counts bits set in both rows.
+uint32_t countCommonBits(const Word* lhs, const Word* rhs, uint32_t words)
+{
+    uint64_t count = 0;
+    uint32_t idx = 0;
+#if defined(__AVX2__)
+    // Nibble lookup popcount: split bytes into nibbles, look their counts up with a shuffle
+    // and horizontally add the bytes of each 64-bit lane with SAD against zero.
+    const auto lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const auto lowNibbleMask = _mm256_set1_epi8(0x0f);
+    auto accumulator = _mm256_setzero_si256();
+    for (; idx + 4 <= words; idx += 4)
+    {
+        auto chunk = _mm256_and_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(lhs + idx)),
+                                      _mm256_load_si256(reinterpret_cast<const __m256i*>(rhs + idx)));
+        auto lowNibbles = _mm256_and_si256(chunk, lowNibbleMask);
+        auto highNibbles = _mm256_and_si256(_mm256_srli_epi16(chunk, 4), lowNibbleMask);
+        auto byteCounts
+            = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lowNibbles), _mm256_shuffle_epi8(lookup, highNibbles));
+        accumulator = _mm256_add_epi64(accumulator, _mm256_sad_epu8(byteCounts, _mm256_setzero_si256()));
+    }
+    count += static_cast<uint64_t>(_mm256_extract_epi64(accumulator, 0)) + _mm256_extract_epi64(accumulator, 1)
+           + _mm256_extract_epi64(accumulator, 2) + _mm256_extract_epi64(accumulator, 3);
+#endif
+    for (; idx < words; idx++)
+    {
+        count += std::popcount(lhs[idx] & rhs[idx]);
+    }
+    return static_cast<uint32_t>(count);
+}
+
+// Removes the bit at the given position, shifting every following bit of the row down by one.
+void eraseBit(Word* row, uint32_t position, uint32_t words)
+{
+    constexpr uint32_t bitsPerWord = 64;
+    auto firstWord = position / bitsPerWord;
+    auto keptMask = (Word{1} << (position % bitsPerWord)) - 1;
+
+    for (auto idx = firstWord; idx < words; idx++)
+    {
+        Word next = idx + 1 < words ? row[idx + 1] : 0;
+        Word shifted = (row[idx] >> 1) | (next << (bitsPerWord - 1));
+        row[idx] = idx == firstWord ? (row[idx] & keptMask) | (shifted & ~keptMask) : shifted;
+    }
+}
+
+bool testBit(const Word* row, uint32_t position)
+{
+    return (row[position / 64] >> (position % 64)) & 1;
+}
+
+void setBit(Word* row, uint32_t position)
+{
+    row[position / 64] |= Word{1} << (position % 64);
+}
+
+void clearBit(Word* row, uint32_t position)
+{
+    row[position / 64] &= ~(Word{1} << (position % 64));
+}
+} // namespace
+
+namespace Graphs
+{
+template <GraphDirectionality directionality>
+uint64_t AdjBitMatrix<directionality>::weightKey(NodeId source, NodeId destination)
+{
+    return (static_cast<uint64_t>(source) << 32) | destination;
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::reportEdge(uint32_t sourceIndex,
+                                              uint32_t destinationIndex,
+                                              void (DegreeTable::*update)(uint32_t, uint32_t))
+{
+    (degrees.*update)(sourceIndex, destinationIndex);
+    if (directionality == GraphDirectionality::undirected and sourceIndex != destinationIndex)
+    {
+        (degrees.*update)(destinationIndex, sourceIndex);
+    }
+}
+
+template <GraphDirectionality directionality>
+auto AdjBitMatrix<directionality>::outgoingRow(uint32_t index) const -> const Word*
+{
+    return bits.data() + static_cast<std::size_t>(index) * wordsPerRow;
+}
+
+template <GraphDirectionality directionality>
+auto AdjBitMatrix<directionality>::outgoingRow(uint32_t index) -> Word*
+{
+    return bits.data() + static_cast<std::size_t>(index) * wordsPerRow;
+}
+
+template <GraphDirectionality directionality>
+auto AdjBitMatrix<directionality>::incommingRow(uint32_t index) const -> const Word*
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        return outgoingRow(index);
+    }
+    return transposedBits.data() + static_cast<std::size_t>(index) * wordsPerRow;
+}
+
+template <GraphDirectionality directionality>
+auto AdjBitMatrix<directionality>::incommingRow(uint32_t index) -> Word*
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        return outgoingRow(index);
+    }
+    return transposedBits.data() + static_cast<std::size_t>(index) * wordsPerRow;
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::resizeToFitNodes(uint32_t nodesCount)
+{
+    constexpr uint32_t bitsPerCacheLine = bitsPerWord * wordsPerCacheLine;
+    auto requiredWords = (nodesCount + bitsPerCacheLine - 1) / bitsPerCacheLine * wordsPerCacheLine;
+    auto currentRows = nodeIndexMapping.size();
+
+    auto restride = [this, currentRows, nodesCount](Bits& matrix, uint32_t newWordsPerRow) {
+        Bits restrided(static_cast<std::size_t>(nodesCount) * newWordsPerRow, 0);
+        for (uint32_t row = 0; row < currentRows; row++)
+        {
+            std::copy_n(matrix.begin() + static_cast<std::size_t>(row) * wordsPerRow,
+                        wordsPerRow,
+                        restrided.begin() + static_cast<std::size_t>(row) * newWordsPerRow);
+        }
+        matrix = std::move(restrided);
+    };
+
+    if (requiredWords > wordsPerRow)
+    {
+        // Grow the stride geometrically, so adding nodes one at a time does not re-layout every row each time.
+        auto newWordsPerRow = std::max(requiredWords, wordsPerRow * 2);
+        restride(bits, newWordsPerRow);
+        if constexpr (directionality == GraphDirectionality::directed)
+        {
+            restride(transposedBits, newWordsPerRow);
+        }
+        wordsPerRow = newWordsPerRow;
+        return;
+    }
+
+    bits.resize(static_cast<std::size_t>(nodesCount) * wordsPerRow, 0);
+    if constexpr (directionality == GraphDirectionality::directed)
+    {
+        transposedBits.resize(static_cast<std::size_t>(nodesCount) * wordsPerRow, 0);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::visitBits(const Word* row, NodeVisitor visitor) const
+{
+    for (uint32_t wordIdx = 0; wordIdx < wordsPerRow; wordIdx++)
+    {
+        for (auto word = row[wordIdx]; word != 0; word &= word - 1)
+        {
+            visitor(nodeIndexMapping.idOf(wordIdx * bitsPerWord + std::countr_zero(word)));
+        }
+    }
+}
+
+template <GraphDirectionality directionality>
+GraphDirectionality AdjBitMatrix<directionality>::getDirectionality() const
+{
+    return Directionality;
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::nodesAmount() const
+{
+    return nodeIndexMapping.size();
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::getOutgoingDegree(NodeId nodeId) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return degrees.outgoingDegreeOf(nodeIdx);
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::getIncommingDegree(NodeId nodeId) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return degrees.incommingDegreeOf(nodeIdx);
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::degreeOf(NodeId nodeId) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return degrees.degreeOf(nodeIdx);
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::graphDegree() const
+{
+    return degrees.maxDegree();
+}
+
+template <GraphDirectionality directionality>
+EdgeInfo AdjBitMatrix<directionality>::findEdge(const EdgeInfo& edge) const
+{
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationIndex = nodeIndexMapping.indexOf(edge.destination);
+
+    if (sourceIndex == NodeIndexMapping::invalidIndex or destinationIndex == NodeIndexMapping::invalidIndex
+        or not testBit(outgoingRow(sourceIndex), destinationIndex))
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    auto weight = weights.find(weightKey(edge.source, edge.destination));
+    return {edge.source, edge.destination, weight != weights.end() ? weight->second : 1};
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::setEdge(const EdgeInfo& edge)
+{
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationIndex = nodeIndexMapping.indexOf(edge.destination);
+    if (sourceIndex == NodeIndexMapping::invalidIndex or destinationIndex == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+
+    auto storeWeight = [this, weight = edge.weight.value_or(1)](NodeId source, NodeId destination) {
+        if (weight == 1)
+        {
+            weights.erase(weightKey(source, destination));
+        }
+        else
+        {
+            weights[weightKey(source, destination)] = weight;
+        }
+    };
+
+    if (not testBit(outgoingRow(sourceIndex), destinationIndex))
+    {
+        reportEdge(sourceIndex, destinationIndex, &DegreeTable::edgeAdded);
+    }
+    setBit(outgoingRow(sourceIndex), destinationIndex);
+    setBit(incommingRow(destinationIndex), sourceIndex);
+    storeWeight(edge.source, edge.destination);
+
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        storeWeight(edge.destination, edge.source);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::removeEdge(const EdgeInfo& edge)
+{
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationIndex = nodeIndexMapping.indexOf(edge.destination);
+    if (sourceIndex == NodeIndexMapping::invalidIndex or destinationIndex == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+
+    if (testBit(outgoingRow(sourceIndex), destinationIndex))
+    {
+        reportEdge(sourceIndex, destinationIndex, &DegreeTable::edgeRemoved);
+    }
+    clearBit(outgoingRow(sourceIndex), destinationIndex);
+    clearBit(incommingRow(destinationIndex), sourceIndex);
+    weights.erase(weightKey(edge.source, edge.destination));
+
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        weights.erase(weightKey(edge.destination, edge.source));
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::addNodes(uint32_t nodesCount)
+{
+    resizeToFitNodes(nodeIndexMapping.size() + nodesCount);
+    nodeIndexMapping.addNodes(nodesCount);
+    degrees.addNodes(nodesCount);
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::removeNode(NodeId node)
+{
+    auto nodeIndex = nodeIndexMapping.indexOf(node);
+    if (nodeIndex == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+
+    visitBits(outgoingRow(nodeIndex), [this, nodeIndex](NodeId neighbor) {
+        reportEdge(nodeIndex, nodeIndexMapping.indexOf(neighbor), &DegreeTable::edgeRemoved);
+    });
+    if constexpr (directionality == GraphDirectionality::directed)
+    {
+        visitBits(incommingRow(nodeIndex), [this, nodeIndex, node](NodeId neighbor) {
+            if (neighbor != node)
+            {
+                reportEdge(nodeIndexMapping.indexOf(neighbor), nodeIndex, &DegreeTable::edgeRemoved);
+            }
+        });
+    }
+    degrees.removeNode(nodeIndex);
+    nodeIndexMapping.removeNode(node);
+
+    auto compact = [this, nodeIndex](Bits& matrix) {
+        auto rowBegin = matrix.begin() + static_cast<std::size_t>(nodeIndex) * wordsPerRow;
+        matrix.erase(rowBegin, rowBegin + wordsPerRow);
+        for (std::size_t offset = 0; offset < matrix.size(); offset += wordsPerRow)
+        {
+            eraseBit(matrix.data() + offset, nodeIndex, wordsPerRow);
+        }
+    };
+
+    compact(bits);
+    if constexpr (directionality == GraphDirectionality::directed)
+    {
+        compact(transposedBits);
+    }
+
+    std::erase_if(weights, [node](const auto& entry) {
+        auto& [key, _] = entry;
+        return static_cast<NodeId>(key >> 32) == node or static_cast<NodeId>(key) == node;
+    });
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::reset()
+{
+    nodeIndexMapping.clear();
+    degrees.clear();
+    wordsPerRow = 0;
+    bits.clear();
+    transposedBits.clear();
+    weights.clear();
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjBitMatrix<directionality>::getNodeIds() const
+{
+    return nodeIndexMapping.ids();
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjBitMatrix<directionality>::getOutgoingNeighborsOf(NodeId node) const
+{
+    std::vector<NodeId> neighbors = {};
+    forEachOutgoingNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjBitMatrix<directionality>::getIncommingNeighborsOf(NodeId node) const
+{
+    std::vector<NodeId> neighbors = {};
+    forEachIncommingNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+std::vector<EdgeInfo> AdjBitMatrix<directionality>::getEdges() const
+{
+    std::vector<EdgeInfo> edges = {};
+    for (uint32_t rowIdx = 0; rowIdx < nodeIndexMapping.size(); rowIdx++)
+    {
+        auto source = nodeIndexMapping.idOf(rowIdx);
+        visitBits(outgoingRow(rowIdx), [this, &edges, source](NodeId destination) {
+            edges.push_back(findEdge({source, destination}));
+        });
+    }
+    return edges;
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::forEachNode(NodeVisitor visitor) const
+{
+    for (auto nodeId : nodeIndexMapping.ids())
+    {
+        visitor(nodeId);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::forEachOutgoingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index != NodeIndexMapping::invalidIndex)
+    {
+        visitBits(outgoingRow(index), visitor);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::forEachIncommingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index != NodeIndexMapping::invalidIndex)
+    {
+        visitBits(incommingRow(index), visitor);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::forEachNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+    const auto* row = outgoingRow(index);
+    const auto* column = incommingRow(index);
+    for (uint32_t wordIdx = 0; wordIdx < wordsPerRow; wordIdx++)
+    {
+        for (auto word = row[wordIdx] | column[wordIdx]; word != 0; word &= word - 1)
+        {
+            visitor(nodeIndexMapping.idOf(wordIdx * bitsPerWord + std::countr_zero(word)));
+        }
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjBitMatrix<directionality>::forEachOutgoingEdge(NodeId node, EdgeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+    visitBits(outgoingRow(index), [this, node, &visitor](NodeId neighbor) {
+        auto weight = weights.empty() ? weights.end() : weights.find(weightKey(node, neighbor));
+        visitor(neighbor, weight != weights.end() ? weight->second : 1);
+    });
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjBitMatrix<directionality>::countCommonNeighbors(NodeId lhs, NodeId rhs) const
+{
+    auto lhsIndex = nodeIndexMapping.indexOf(lhs);
+    auto rhsIndex = nodeIndexMapping.indexOf(rhs);
+    if (lhsIndex == NodeIndexMapping::invalidIndex or rhsIndex == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return countCommonBits(outgoingRow(lhsIndex), outgoingRow(rhsIndex), wordsPerRow);
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjBitMatrix<directionality>::getCommonNeighborsOf(NodeId lhs, NodeId rhs) const
+{
+    auto lhsIndex = nodeIndexMapping.indexOf(lhs);
+    auto rhsIndex = nodeIndexMapping.indexOf(rhs);
+    if (lhsIndex == NodeIndexMapping::invalidIndex or rhsIndex == NodeIndexMapping::invalidIndex)
+    {
+        return {};
+    }
+
+    Bits intersection(wordsPerRow);
+    combineRows<true>(outgoingRow(lhsIndex), outgoingRow(rhsIndex), intersection.data(), wordsPerRow);
+
+    std::vector<NodeId> neighbors = {};
+    visitBits(intersection.data(), [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjBitMatrix<directionality>::getNeighborhoodUnionOf(NodeId lhs, NodeId rhs) const
+{
+    auto lhsIndex = nodeIndexMapping.indexOf(lhs);
+    auto rhsIndex = nodeIndexMapping.indexOf(rhs);
+    if (lhsIndex == NodeIndexMapping::invalidIndex)
+    {
+        return getOutgoingNeighborsOf(rhs);
+    }
+    if (rhsIndex == NodeIndexMapping::invalidIndex)
+    {
+        return getOutgoingNeighborsOf(lhs);
+    }
+
+    Bits sum(wordsPerRow);
+    combineRows<false>(outgoingRow(lhsIndex), outgoingRow(rhsIndex), sum.data(), wordsPerRow);
+
+    std::vector<NodeId> neighbors = {};
+    visitBits(sum.data(), [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+std::string AdjBitMatrix<directionality>::show() const
+{
+    std::stringstream out;
+    out << std::format("\nNodes amount = {}\n[\n", nodeIndexMapping.size());
+    for (auto source : nodeIndexMapping.ids())
+    {
+        for (auto destination : nodeIndexMapping.ids())
+        {
+            out << std::format("{}, ", findEdge({source, destination}).weight.value_or(0));
+        }
+        out << "\n";
+    }
+    out << "]\n";
+    return out.str();
+}
+} // namespace Graphs
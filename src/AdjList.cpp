@@ -1,7 +1,9 @@
 // this
 #include <algorithm>
 #include <Graphs/AdjList.hpp>
+#include <iterator>
 #include <sstream>
+#include <utility>
 
 namespace
 {
@@ -29,27 +31,41 @@ namespace
         inserter(coordsToInsert);
     }
 }*/
+
+void insertSorted(std::vector<Graphs::NodeId>& range, Graphs::NodeId node)
+{
+    auto position = std::ranges::lower_bound(range, node);
+    if (position == range.end() or *position != node)
+    {
+        range.insert(position, node);
+    }
+}
+
+void eraseSorted(std::vector<Graphs::NodeId>& range, Graphs::NodeId node)
+{
+    auto position = std::ranges::lower_bound(range, node);
+    if (position != range.end() and *position == node)
+    {
+        range.erase(position);
+    }
+}
 } // namespace
 
 namespace Graphs
 {
 template <GraphDirectionality directionality>
-AdjList<directionality>::AdjList(const Graph& graph)
+AdjList<directionality>::AdjList(const Graph& graph) : nodeIndexMapping(graph.getNodeIds())
 {
-    nodes.reserve(graph.nodesAmount());
+    nodes.resize(nodeIndexMapping.size());
+    degrees.addNodes(nodeIndexMapping.size());
+    if constexpr (directionality == GraphDirectionality::directed)
+    {
+        incommingNodes.resize(nodeIndexMapping.size());
+    }
 
-    for (uint32_t i = 0; i < nodes.size(); i++)
+    for (const auto& edge : graph.getEdges())
     {
-        auto& node = nodes[i];
-        for (uint32_t j = 0; j < nodes.size(); j++)
-        {
-            auto edge = graph.findEdge({i + 1, j + 1});
-            if (edge.weight.has_value() and edge.weight.value() > 0)
-            {
-                node.emplace_back(j + 1);
-            }
-        }
-        nodeMap.insert(std::pair<uint32_t, uint32_t>(i + 1, i));
+        setEdge(edge);
     }
 }
 
@@ -92,12 +108,12 @@ template <GraphDirectionality directionality>
 std::string AdjList<directionality>::show() const
 {
     std::stringstream outStream;
-    outStream << std::format("Nodes amount = {}\n{{\n", nodeMap.size());
+    outStream << std::format("Nodes amount = {}\n{{\n", nodeIndexMapping.size());
 
-    for (auto& [index, mapping] : nodeMap)
+    for (uint32_t index = 0; index < nodes.size(); index++)
     {
-        outStream << std::format("{}: ", index);
-        for (auto& [_, destination, weight] : nodes[mapping])
+        outStream << std::format("{}: ", nodeIndexMapping.idOf(index));
+        for (auto& [_, destination, weight] : nodes[index])
         {
             if (weight.has_value())
             {
@@ -125,45 +141,56 @@ uint32_t AdjList<directionality>::nodesAmount() const
 template <GraphDirectionality directionality>
 uint32_t AdjList<directionality>::getOutgoingDegree(NodeId nodeId) const
 {
-    auto nodeMapping = nodeMap.find(nodeId);
-    if (nodeMapping == nodeMap.end())
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
         return 0;
     }
-    auto [_, nodeIdx] = *nodeMapping;
-    return nodes[nodeIdx].size();
+    return degrees.outgoingDegreeOf(nodeIdx);
 }
 
 template <GraphDirectionality directionality>
 uint32_t AdjList<directionality>::getIncommingDegree(NodeId nodeId) const
 {
-    uint32_t degree = 0;
-    for (auto& node : nodes)
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
-        auto nodeItr = std::ranges::find_if(node, [nodeId](auto& neighbor) {
-            return neighbor.destination == nodeId;
-        });
-        if (nodeItr != node.end())
-        {
-            ++degree;
-        }
+        return 0;
     }
+    return degrees.incommingDegreeOf(nodeIdx);
+}
 
-    return degree;
+template <GraphDirectionality directionality>
+uint32_t AdjList<directionality>::degreeOf(NodeId nodeId) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return degrees.degreeOf(nodeIdx);
+}
+
+template <GraphDirectionality directionality>
+uint32_t AdjList<directionality>::graphDegree() const
+{
+    return degrees.maxDegree();
 }
 
 template <GraphDirectionality directionality>
 void AdjList<directionality>::reset()
 {
     nodes.clear();
-    nodeMap.clear();
+    incommingNodes.clear();
+    nodeIndexMapping.clear();
+    degrees.clear();
 }
 
 template <GraphDirectionality directionality>
 std::vector<EdgeInfo> AdjList<directionality>::getEdges() const
 {
     std::vector<EdgeInfo> edges = {};
-    for (auto node : nodes)
+    for (const auto& node : nodes)
     {
         std::ranges::copy(node, std::back_inserter(edges));
     }
@@ -173,13 +200,14 @@ std::vector<EdgeInfo> AdjList<directionality>::getEdges() const
 template <GraphDirectionality directionality>
 std::vector<NodeId> AdjList<directionality>::getOutgoingNeighborsOf(NodeId node) const
 {
-    auto nodeMapping = nodeMap.find(node);
-    if (nodeMapping == nodeMap.end())
+    auto nodeIdx = nodeIndexMapping.indexOf(node);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
         return {};
     }
     std::vector<NodeId> neighbors;
-    for (auto& [_, dest, weight] : nodes[nodeMapping->second])
+    neighbors.reserve(nodes[nodeIdx].size());
+    for (auto& [_, dest, weight] : nodes[nodeIdx])
     {
         neighbors.push_back(dest);
     }
@@ -190,93 +218,277 @@ std::vector<NodeId> AdjList<directionality>::getOutgoingNeighborsOf(NodeId node)
 template <GraphDirectionality directionality>
 std::vector<NodeId> AdjList<directionality>::getIncommingNeighborsOf(NodeId node) const
 {
-    auto nodeMapping = nodeMap.find(node);
-    if (nodeMapping == nodeMap.end())
+    std::vector<NodeId> neighbors;
+    forEachIncommingNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+void AdjList<directionality>::forEachNode(NodeVisitor visitor) const
+{
+    for (auto nodeId : nodeIndexMapping.ids())
     {
-        return {};
+        visitor(nodeId);
     }
-    auto& [tgtNodeIndex, _] = *nodeMapping;
-    std::vector<NodeId> neighbors;
-    for (auto& node : nodes)
+}
+
+template <GraphDirectionality directionality>
+void AdjList<directionality>::forEachOutgoingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(node);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+    for (const auto& neighbor : nodes[nodeIdx])
     {
-        if (std::ranges::find_if(node,
-                                 [tgtNodeIndex](auto& neighbor) {
-                                     return neighbor.destination == tgtNodeIndex;
-                                 })
-            != node.end())
+        visitor(neighbor.destination);
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjList<directionality>::forEachOutgoingEdge(NodeId node, EdgeVisitor visitor) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(node);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+    for (const auto& neighbor : nodes[nodeIdx])
+    {
+        visitor(neighbor.destination, neighbor.weight.value_or(1));
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjList<directionality>::forEachIncommingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        forEachOutgoingNeighbor(node, visitor);
+    }
+    else
+    {
+        auto nodeIdx = nodeIndexMapping.indexOf(node);
+        if (nodeIdx == NodeIndexMapping::invalidIndex)
+        {
+            return;
+        }
+        for (auto neighbor : incommingNodes[nodeIdx])
         {
-            neighbors.emplace_back(node[0].source);
+            visitor(neighbor);
         }
     }
+}
 
-    return neighbors;
+template <GraphDirectionality directionality>
+void AdjList<directionality>::forEachNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        forEachOutgoingNeighbor(node, visitor);
+    }
+    else
+    {
+        auto nodeIdx = nodeIndexMapping.indexOf(node);
+        if (nodeIdx == NodeIndexMapping::invalidIndex)
+        {
+            return;
+        }
+        // Both lists are sorted, so a single merge visits each neighbor once.
+        const auto& outgoing = nodes[nodeIdx];
+        const auto& incomming = incommingNodes[nodeIdx];
+        auto out = outgoing.begin();
+        auto in = incomming.begin();
+        while (out != outgoing.end() or in != incomming.end())
+        {
+            if (in == incomming.end() or (out != outgoing.end() and out->destination < *in))
+            {
+                visitor((out++)->destination);
+            }
+            else if (out == outgoing.end() or *in < out->destination)
+            {
+                visitor(*in++);
+            }
+            else
+            {
+                visitor(*in++);
+                ++out;
+            }
+        }
+    }
 }
 
 template <GraphDirectionality directionality>
-void AdjList<directionality>::addNeighborAndSortRange(Neighbors& range, EdgeInfo tgtNeighbor)
+bool AdjList<directionality>::addNeighborAndSortRange(Neighbors& range, EdgeInfo tgtNeighbor)
 {
     if (not tgtNeighbor.weight.has_value())
     {
         throw std::invalid_argument("Weight must be provided");
     }
 
-    auto element = std::ranges::find_if(range, [&tgtNeighbor](auto& elem) {
-        auto& [source, destination, _] = elem;
-        auto& [tgtSource, tgtDestination, _] = tgtNeighbor;
-
-        return source == tgtSource and destination == tgtDestination;
-    });
-
-    if (element == range.end())
+    auto element = std::ranges::lower_bound(range, tgtNeighbor.destination, std::less<>(), &EdgeInfo::destination);
+    if (element == range.end() or element->destination != tgtNeighbor.destination)
     {
-        range.emplace_back(tgtNeighbor);
-        std::ranges::sort(range, std::less<>(), &EdgeInfo::destination);
-    }
-    else
-    {
-        element->weight = tgtNeighbor.weight;
+        range.insert(element, tgtNeighbor);
+        return true;
     }
+
+    element->weight = tgtNeighbor.weight;
+    return false;
 }
 
 template <GraphDirectionality directionality>
 void AdjList<directionality>::setEdge(const EdgeInfo& edge)
 {
-    auto sourceNodeMapping = nodeMap.find(edge.source);
-    auto destinationNodeMapping = nodeMap.find(edge.destination);
+    auto sourceNodeIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
 
-    if (sourceNodeMapping == nodeMap.end() or destinationNodeMapping == nodeMap.end())
+    if (sourceNodeIndex == NodeIndexMapping::invalidIndex or destinationNodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
-    auto& [sourceNodeId, sourceNodeIndex] = *sourceNodeMapping;
-    auto& [destinationNodeId, destinationNodeIndex] = *destinationNodeMapping;
 
-    addNeighborAndSortRange(nodes[sourceNodeIndex], {edge.source, edge.destination, edge.weight.value_or(1)});
+    auto isNewEdge
+        = addNeighborAndSortRange(nodes[sourceNodeIndex], {edge.source, edge.destination, edge.weight.value_or(1)});
     if constexpr (directionality == GraphDirectionality::undirected)
     {
         addNeighborAndSortRange(nodes[destinationNodeIndex], {edge.destination, edge.source, edge.weight.value_or(1)});
     }
+    else if (isNewEdge)
+    {
+        insertSorted(incommingNodes[destinationNodeIndex], edge.source);
+    }
+
+    if (isNewEdge)
+    {
+        degrees.edgeAdded(sourceNodeIndex, destinationNodeIndex);
+        if (directionality == GraphDirectionality::undirected and sourceNodeIndex != destinationNodeIndex)
+        {
+            degrees.edgeAdded(destinationNodeIndex, sourceNodeIndex);
+        }
+    }
+}
+
+template <GraphDirectionality directionality>
+void AdjList<directionality>::setEdges(const std::vector<EdgeInfo>& edges)
+{
+    // Every arc is tagged with the row it belongs to. A stable sort groups the arcs by row and destination while
+    // keeping their input order, so each touched row is merged once and the last weight given for an edge wins.
+    std::vector<std::pair<uint32_t, EdgeInfo>> arcs;
+    arcs.reserve(directionality == GraphDirectionality::undirected ? 2 * edges.size() : edges.size());
+    for (const auto& edge : edges)
+    {
+        auto sourceNodeIndex = nodeIndexMapping.indexOf(edge.source);
+        auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
+        if (sourceNodeIndex == NodeIndexMapping::invalidIndex or destinationNodeIndex == NodeIndexMapping::invalidIndex)
+        {
+            continue;
+        }
+
+        auto weight = edge.weight.value_or(1);
+        arcs.emplace_back(sourceNodeIndex, EdgeInfo{edge.source, edge.destination, weight});
+        if (directionality == GraphDirectionality::undirected and sourceNodeIndex != destinationNodeIndex)
+        {
+            arcs.emplace_back(destinationNodeIndex, EdgeInfo{edge.destination, edge.source, weight});
+        }
+    }
+    std::ranges::stable_sort(arcs, std::less<>(), [](const auto& arc) {
+        return std::pair{arc.first, arc.second.destination};
+    });
+
+    // In-edge sources of new directed edges, as (destination index, source id).
+    std::vector<std::pair<uint32_t, NodeId>> newIncomming;
+    Neighbors merged;
+    for (auto first = arcs.begin(); first != arcs.end();)
+    {
+        auto rowIndex = first->first;
+        auto last = std::find_if(first, arcs.end(), [rowIndex](const auto& arc) { return arc.first != rowIndex; });
+
+        auto& row = nodes[rowIndex];
+        merged.clear();
+        merged.reserve(row.size() + static_cast<std::size_t>(last - first));
+        auto existing = row.begin();
+        for (auto arc = first; arc != last; ++arc)
+        {
+            const auto& edge = arc->second;
+            if (std::next(arc) != last and std::next(arc)->second.destination == edge.destination)
+            {
+                continue;
+            }
+
+            while (existing != row.end() and existing->destination < edge.destination)
+            {
+                merged.push_back(*existing++);
+            }
+            if (existing != row.end() and existing->destination == edge.destination)
+            {
+                ++existing;
+            }
+            else
+            {
+                auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
+                degrees.edgeAdded(rowIndex, destinationNodeIndex);
+                if constexpr (directionality == GraphDirectionality::directed)
+                {
+                    newIncomming.emplace_back(destinationNodeIndex, edge.source);
+                }
+            }
+            merged.push_back(edge);
+        }
+        merged.insert(merged.end(), existing, row.end());
+        row.swap(merged);
+        first = last;
+    }
+
+    std::ranges::sort(newIncomming);
+    for (auto first = newIncomming.begin(); first != newIncomming.end();)
+    {
+        auto nodeIndex = first->first;
+        auto last = std::find_if(first, newIncomming.end(), [nodeIndex](const auto& in) {
+            return in.first != nodeIndex;
+        });
+
+        auto& sources = incommingNodes[nodeIndex];
+        auto middle = sources.size();
+        std::transform(first, last, std::back_inserter(sources), [](const auto& in) { return in.second; });
+        std::inplace_merge(sources.begin(), sources.begin() + middle, sources.end());
+        first = last;
+    }
 }
 
 template <GraphDirectionality directionality>
 void AdjList<directionality>::removeEdge(const EdgeInfo& edge)
 {
-    auto sourceNodeMapping = nodeMap.find(edge.source);
-    auto destinationNodeMapping = nodeMap.find(edge.destination);
-    if (sourceNodeMapping == nodeMap.end() or destinationNodeMapping == nodeMap.end())
+    auto sourceNodeIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
+    if (sourceNodeIndex == NodeIndexMapping::invalidIndex or destinationNodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
 
-    auto& [_, sourceNodeIndex] = *sourceNodeMapping;
-    auto& [_, destinationNodeIndex] = *destinationNodeMapping;
-
     auto [firstSrc, lastSrc] = std::ranges::remove_if(nodes[sourceNodeIndex], [&edge](auto& elem) {
         return elem.destination == edge.destination;
     });
+    if (firstSrc == lastSrc)
+    {
+        return;
+    }
     nodes[sourceNodeIndex].erase(firstSrc, lastSrc);
 
-    if constexpr (directionality == GraphDirectionality::undirected)
+    degrees.edgeRemoved(sourceNodeIndex, destinationNodeIndex);
+    if (directionality == GraphDirectionality::undirected and sourceNodeIndex != destinationNodeIndex)
+    {
+        degrees.edgeRemoved(destinationNodeIndex, sourceNodeIndex);
+    }
+
+    if constexpr (directionality == GraphDirectionality::directed)
+    {
+        eraseSorted(incommingNodes[destinationNodeIndex], edge.source);
+    }
+    else
     {
         auto [firstDst, lastDst] = std::ranges::remove_if(nodes[destinationNodeIndex], [&edge](auto& elem) {
             return elem.destination == edge.source;
@@ -288,58 +500,74 @@ void AdjList<directionality>::removeEdge(const EdgeInfo& edge)
 template <GraphDirectionality directionality>
 void AdjList<directionality>::addNodes(uint32_t nodesAmount)
 {
-    auto highestId = nodeMap.empty() ? 0 : nodeMap.rbegin()->first;
-
-    for (uint32_t i = 0; i < nodesAmount; i++)
+    nodeIndexMapping.addNodes(nodesAmount);
+    nodes.resize(nodeIndexMapping.size());
+    degrees.addNodes(nodesAmount);
+    if constexpr (directionality == GraphDirectionality::directed)
     {
-        nodeMap.insert({highestId + i + 1, nodes.size() + i});
+        incommingNodes.resize(nodeIndexMapping.size());
     }
-    nodes.resize(nodeMap.size());
 }
 
 template <GraphDirectionality directionality>
 void AdjList<directionality>::removeNode(NodeId node)
 {
-    auto nodeMapping = nodeMap.find(node);
-    if (nodeMapping == nodeMap.end())
+    auto nodeIndex = nodeIndexMapping.indexOf(node);
+    if (nodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
 
-    auto& [nodeId, nodeIndex] = *nodeMapping;
+    auto removeFromNeighborsOf = [this, node](NodeId neighbor) {
+        auto& neighbors = nodes[nodeIndexMapping.indexOf(neighbor)];
+        auto [first, last] = std::ranges::remove(neighbors, node, &EdgeInfo::destination);
+        neighbors.erase(first, last);
+    };
 
-    for (auto& neighbors : nodes)
+    // Only the rows of actual neighbors can refer to the node, so there is no need to scan the whole graph.
+    if constexpr (directionality == GraphDirectionality::directed)
     {
-        auto [first, last] = std::ranges::remove_if(neighbors, [&nodeId](auto& neighbor) {
-            return neighbor.destination == nodeId;
-        });
-        neighbors.erase(first, last);
+        for (const auto& neighbor : nodes[nodeIndex])
+        {
+            auto neighborIndex = nodeIndexMapping.indexOf(neighbor.destination);
+            eraseSorted(incommingNodes[neighborIndex], node);
+            degrees.edgeRemoved(nodeIndex, neighborIndex);
+        }
+        for (auto neighbor : incommingNodes[nodeIndex])
+        {
+            removeFromNeighborsOf(neighbor);
+            degrees.edgeRemoved(nodeIndexMapping.indexOf(neighbor), nodeIndex);
+        }
+        incommingNodes.erase(std::next(incommingNodes.begin(), nodeIndex));
     }
-
-    std::ranges::for_each(nodeMap, [&nodeIndex](auto& mapping) {
-        auto& [_, index] = mapping;
-        if (index > nodeIndex)
+    else
+    {
+        for (const auto& neighbor : nodes[nodeIndex])
         {
-            --index;
+            auto neighborIndex = nodeIndexMapping.indexOf(neighbor.destination);
+            degrees.edgeRemoved(nodeIndex, neighborIndex);
+            if (neighbor.destination != node)
+            {
+                removeFromNeighborsOf(neighbor.destination);
+                degrees.edgeRemoved(neighborIndex, nodeIndex);
+            }
         }
-    });
+    }
+
+    degrees.removeNode(nodeIndex);
     nodes.erase(std::next(nodes.begin(), nodeIndex));
-    nodeMap.erase(nodeMapping);
+    nodeIndexMapping.removeNode(node);
 }
 
 template <GraphDirectionality directionality>
 EdgeInfo AdjList<directionality>::findEdge(const EdgeInfo& edge) const
 {
-    auto source = nodeMap.find(edge.source);
-    auto destination = nodeMap.find(edge.destination);
-
-    if (source == nodeMap.end() or destination == nodeMap.end())
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    if (sourceIndex == NodeIndexMapping::invalidIndex or not nodeIndexMapping.contains(edge.destination))
     {
         return {edge.source, edge.destination, std::nullopt};
     }
 
-    auto& [_, sourceIndex] = *source;
-
     auto neighbor = std::ranges::find(nodes[sourceIndex], edge.destination, &EdgeInfo::destination);
 
     if (neighbor == nodes[sourceIndex].end())
@@ -352,11 +580,6 @@ EdgeInfo AdjList<directionality>::findEdge(const EdgeInfo& edge) const
 template <GraphDirectionality directionality>
 std::vector<NodeId> AdjList<directionality>::getNodeIds() const
 {
-    std::vector<NodeId> nodeIds;
-    for (const auto& [nodeId, _] : nodeMap)
-    {
-        nodeIds.push_back(nodeId);
-    }
-    return nodeIds;
+    return nodeIndexMapping.ids();
 }
 } // namespace Graphs
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <Graphs/AdjMatrix.hpp>
+#include <mutex>
 #include <ranges>
 #include <sstream>
 
@@ -8,25 +9,104 @@ namespace Graphs
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::resizeMatrixToFitNodes(uint32_t nodesCount)
 {
-    if (nodesCount > matrix.size())
-    {
-        auto nodesAmountDiff = nodesCount - matrix.size();
-        auto maxNodeItr = nodeIndexMapping.rbegin();
-        auto maxNodeId = maxNodeItr != nodeIndexMapping.rend() ? maxNodeItr->first : 0;
+    auto resize = [this, nodesCount](std::vector<WeightType>& buffer, uint32_t newStride) {
+        if (newStride == stride)
+        {
+            buffer.resize(static_cast<std::size_t>(nodesCount) * stride, 0);
+            return;
+        }
 
-        for (uint32_t i = 0; i < nodesAmountDiff; i++)
+        std::vector<WeightType> relaidOut(static_cast<std::size_t>(nodesCount) * newStride, 0);
+        for (uint32_t row = 0; row < nodeIndexMapping.size(); row++)
         {
-            nodeIndexMapping.insert(std::make_pair(maxNodeId + i + 1, matrix.size() + i));
+            std::copy_n(buffer.begin() + static_cast<std::size_t>(row) * stride,
+                        nodeIndexMapping.size(),
+                        relaidOut.begin() + static_cast<std::size_t>(row) * newStride);
         }
+        buffer = std::move(relaidOut);
+    };
+
+    // Like std::vector capacity, the stride at least doubles, so batches of additions re-layout rarely.
+    auto newStride = nodesCount > stride ? std::max(nodesCount, stride * 2) : stride;
+    resize(cells, newStride);
+    stride = newStride;
+    dropTransposedCells();
+}
 
-        matrix.resize(nodesCount);
-        for (auto& row : matrix)
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::removeFromCells(std::vector<WeightType>& buffer, uint32_t nodeIndex) const
+{
+    // Called once the node is gone from the mapping, so the buffer still holds one more row than the mapping.
+    auto remainingNodes = nodeIndexMapping.size();
+    for (uint32_t destinationRow = 0; destinationRow < remainingNodes; destinationRow++)
+    {
+        auto sourceRow = destinationRow < nodeIndex ? destinationRow : destinationRow + 1;
+        auto source = buffer.begin() + static_cast<std::size_t>(sourceRow) * stride;
+        auto destination = buffer.begin() + static_cast<std::size_t>(destinationRow) * stride;
+
+        // Every cell moves towards the front of the buffer, so a single forward pass compacts it in place.
+        destination = std::copy(source, source + nodeIndex, destination);
+        destination = std::copy(source + nodeIndex + 1, source + remainingNodes + 1, destination);
+        *destination = 0;
+    }
+    buffer.resize(static_cast<std::size_t>(remainingNodes) * stride);
+}
+
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::reportEdge(uint32_t sourceIndex,
+                                           uint32_t destinationIndex,
+                                           void (DegreeTable::*update)(uint32_t, uint32_t))
+{
+    (degrees.*update)(sourceIndex, destinationIndex);
+    if (directionality == GraphDirectionality::undirected and sourceIndex != destinationIndex)
+    {
+        (degrees.*update)(destinationIndex, sourceIndex);
+    }
+}
+
+template <GraphDirectionality directionality>
+const WeightType* AdjMatrix<directionality>::outgoingRow(uint32_t index) const
+{
+    return cells.data() + static_cast<std::size_t>(index) * stride;
+}
+
+template <GraphDirectionality directionality>
+const WeightType* AdjMatrix<directionality>::incommingRow(uint32_t index) const
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        return outgoingRow(index);
+    }
+    else
+    {
+        // Readers may race to build the copy, so only the first one transposes the cells.
+        if (not transposedCells.isValid.load(std::memory_order_acquire))
         {
-            row.resize(nodesCount);
+            std::scoped_lock lock(transposedCells.mutex);
+            if (not transposedCells.isValid.load(std::memory_order_relaxed))
+            {
+                transposedCells.cells.assign(cells.size(), 0);
+                for (uint32_t row = 0; row < nodeIndexMapping.size(); row++)
+                {
+                    const auto* source = outgoingRow(row);
+                    for (uint32_t column = 0; column < nodeIndexMapping.size(); column++)
+                    {
+                        transposedCells.cells[static_cast<std::size_t>(column) * stride + row] = source[column];
+                    }
+                }
+                transposedCells.isValid.store(true, std::memory_order_release);
+            }
         }
+        return transposedCells.cells.data() + static_cast<std::size_t>(index) * stride;
     }
 }
 
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::dropTransposedCells()
+{
+    transposedCells.isValid.store(false, std::memory_order_relaxed);
+}
+
 template <GraphDirectionality directionality>
 GraphDirectionality AdjMatrix<directionality>::getDirectionality() const
 {
@@ -37,88 +117,79 @@ template <GraphDirectionality directionality>
 AdjMatrix<directionality>::AdjMatrix(const Graph& other)
 {
     resizeMatrixToFitNodes(other.nodesAmount());
+    nodeIndexMapping = NodeIndexMapping(other.getNodeIds());
+    degrees.addNodes(nodeIndexMapping.size());
 
-    for (uint32_t i = 1; i <= matrix.size(); i++)
+    for (const auto& edge : other.getEdges())
     {
-        for (uint32_t j = 1; j <= matrix[i].size(); j++)
-        {
-            matrix[i - 1][j - 1] = other.findEdge({i + 1, j + 1}).weight.value_or(0);
-        }
+        setEdge(edge);
     }
 }
 
 template <GraphDirectionality directionality>
 uint32_t AdjMatrix<directionality>::getOutgoingDegree(NodeId nodeId) const
 {
-    auto nodeMapping = nodeIndexMapping.find(nodeId);
-    if (nodeMapping == nodeIndexMapping.end())
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
         return 0;
     }
-
-    auto [_, nodeIdx] = *nodeMapping;
-    uint32_t degree = 0;
-
-    for (auto edge : matrix[nodeIdx])
-    {
-        if (edge != 0)
-        {
-            ++degree;
-        }
-    }
-    return degree;
+    return degrees.outgoingDegreeOf(nodeIdx);
 }
 
 template <GraphDirectionality directionality>
 uint32_t AdjMatrix<directionality>::getIncommingDegree(NodeId nodeId) const
 {
-    auto nodeMapping = nodeIndexMapping.find(nodeId);
-    if (nodeMapping == nodeIndexMapping.end())
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
         return 0;
     }
+    return degrees.incommingDegreeOf(nodeIdx);
+}
 
-    auto [_, nodeIdx] = *nodeMapping;
-    uint32_t degree = 0;
-
-    for (auto row : matrix)
+template <GraphDirectionality directionality>
+uint32_t AdjMatrix<directionality>::degreeOf(NodeId nodeId) const
+{
+    auto nodeIdx = nodeIndexMapping.indexOf(nodeId);
+    if (nodeIdx == NodeIndexMapping::invalidIndex)
     {
-        if (row[nodeIdx] != 0)
-        {
-            ++degree;
-        }
+        return 0;
     }
+    return degrees.degreeOf(nodeIdx);
+}
 
-    return degree;
+template <GraphDirectionality directionality>
+uint32_t AdjMatrix<directionality>::graphDegree() const
+{
+    return degrees.maxDegree();
 }
 
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::reset()
 {
-    matrix.clear();
     nodeIndexMapping.clear();
+    degrees.clear();
+    stride = 0;
+    cells.clear();
+    dropTransposedCells();
+    transposedCells.cells.clear();
 }
 
 template <GraphDirectionality directionality>
 std::vector<EdgeInfo> AdjMatrix<directionality>::getEdges() const
 {
-    auto findMapping = [this](auto matrixIdx) {
-        auto [nodeId, _] = *(std::ranges::find_if(nodeIndexMapping, [matrixIdx](auto elem) {
-            auto& [_, index] = elem;
-            return index == matrixIdx;
-        }));
-        return nodeId;
-    };
-
     std::vector<EdgeInfo> edges = {};
-    for (uint32_t rowIdx = 0; auto row : matrix)
+    for (uint32_t rowIdx = 0; rowIdx < nodeIndexMapping.size(); rowIdx++)
     {
-        for (uint32_t edgeIdx = 0; auto edgeWeight : row)
+        const auto* row = outgoingRow(rowIdx);
+        for (uint32_t edgeIdx = 0; edgeIdx < nodeIndexMapping.size(); edgeIdx++)
         {
-            if (edgeWeight != 0)
+            if (auto edgeWeight = row[edgeIdx]; edgeWeight != 0)
             {
-                edges.push_back(
-                    {.source = findMapping(rowIdx), .destination = findMapping(edgeIdx), .weight = edgeWeight});
+                edges.push_back({.source = nodeIndexMapping.idOf(rowIdx),
+                                 .destination = nodeIndexMapping.idOf(edgeIdx),
+                                 .weight = edgeWeight});
             }
         }
     }
@@ -177,85 +248,123 @@ std::vector<EdgeInfo> AdjMatrix<directionality>::getEdges() const
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::setEdge(const EdgeInfo& edge)
 {
-    auto sourceNodeMapping = nodeIndexMapping.find(edge.source);
-    auto destinationNodeMapping = nodeIndexMapping.find(edge.destination);
-    if (sourceNodeMapping == nodeIndexMapping.end() or destinationNodeMapping == nodeIndexMapping.end())
+    storeEdge(edge);
+    dropTransposedCells();
+}
+
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::setEdges(const std::vector<EdgeInfo>& edges)
+{
+    for (const auto& edge : edges)
+    {
+        storeEdge(edge);
+    }
+    dropTransposedCells();
+}
+
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::storeEdge(const EdgeInfo& edge)
+{
+    auto sourceNodeIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
+    if (sourceNodeIndex == NodeIndexMapping::invalidIndex or destinationNodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
-    auto& [_, sourceNodeIndex] = *sourceNodeMapping;
-    auto& [_, destinationNodeIndex] = *destinationNodeMapping;
 
-    this->matrix[sourceNodeIndex][destinationNodeIndex] = edge.weight.value_or(1);
+    auto weight = edge.weight.value_or(1);
+    auto& cell = cells[static_cast<std::size_t>(sourceNodeIndex) * stride + destinationNodeIndex];
+    // A zero weight is indistinguishable from a missing edge, so storing it removes the edge.
+    if (cell == 0 and weight != 0)
+    {
+        reportEdge(sourceNodeIndex, destinationNodeIndex, &DegreeTable::edgeAdded);
+    }
+    else if (cell != 0 and weight == 0)
+    {
+        reportEdge(sourceNodeIndex, destinationNodeIndex, &DegreeTable::edgeRemoved);
+    }
+    cell = weight;
 
     if constexpr (directionality == GraphDirectionality::undirected)
     {
-        this->matrix[destinationNodeIndex][sourceNodeIndex] = edge.weight.value_or(1);
+        cells[static_cast<std::size_t>(destinationNodeIndex) * stride + sourceNodeIndex] = weight;
     }
 }
 
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::addNodes(uint32_t nodesCount)
 {
-    resizeMatrixToFitNodes(matrix.size() + nodesCount);
+    resizeMatrixToFitNodes(nodeIndexMapping.size() + nodesCount);
+    nodeIndexMapping.addNodes(nodesCount);
+    degrees.addNodes(nodesCount);
 }
 
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::removeEdge(const EdgeInfo& edge)
 {
-    auto sourceNodeMapping = nodeIndexMapping.find(edge.source);
-    auto destinationNodeMapping = nodeIndexMapping.find(edge.destination);
-    if (sourceNodeMapping == nodeIndexMapping.end() or destinationNodeMapping == nodeIndexMapping.end())
+    auto sourceNodeIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationNodeIndex = nodeIndexMapping.indexOf(edge.destination);
+    if (sourceNodeIndex == NodeIndexMapping::invalidIndex or destinationNodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
-    auto& [_, sourceNodeIndex] = *sourceNodeMapping;
-    auto& [_, destinationNodeIndex] = *destinationNodeMapping;
-    matrix[sourceNodeIndex][destinationNodeIndex] = 0;
+
+    auto& cell = cells[static_cast<std::size_t>(sourceNodeIndex) * stride + destinationNodeIndex];
+    if (cell != 0)
+    {
+        reportEdge(sourceNodeIndex, destinationNodeIndex, &DegreeTable::edgeRemoved);
+    }
+    cell = 0;
 
     if constexpr (directionality == GraphDirectionality::undirected)
     {
-        matrix[destinationNodeIndex][sourceNodeIndex] = 0;
+        cells[static_cast<std::size_t>(destinationNodeIndex) * stride + sourceNodeIndex] = 0;
     }
+    dropTransposedCells();
 }
 
 template <GraphDirectionality directionality>
 void AdjMatrix<directionality>::removeNode(NodeId node)
 {
-    auto nodeItr = nodeIndexMapping.find(node);
-    if (nodeItr == nodeIndexMapping.end())
+    auto nodeIndex = nodeIndexMapping.indexOf(node);
+    if (nodeIndex == NodeIndexMapping::invalidIndex)
     {
         return;
     }
 
-    auto& [_, nodeIndex] = *nodeItr;
-    for (auto& [_, index] : std::ranges::subrange(std::next(nodeItr, 1), nodeIndexMapping.end()))
+    // The node is scanned once before the matrix changes, so the column is read in place
+    // instead of building the transposed copy only to drop it right after.
+    const auto* row = outgoingRow(nodeIndex);
+    for (uint32_t neighborIndex = 0; neighborIndex < nodeIndexMapping.size(); neighborIndex++)
     {
-        if (index > nodeIndex)
+        if (row[neighborIndex] != 0)
         {
-            index--;
+            reportEdge(nodeIndex, neighborIndex, &DegreeTable::edgeRemoved);
+        }
+        if (directionality == GraphDirectionality::directed
+            and outgoingRow(neighborIndex)[nodeIndex] != 0 and neighborIndex != nodeIndex)
+        {
+            reportEdge(neighborIndex, nodeIndex, &DegreeTable::edgeRemoved);
         }
     }
+    degrees.removeNode(nodeIndex);
+    nodeIndexMapping.removeNode(node);
 
-    matrix.erase(matrix.begin() + nodeIndex);
-    for (auto& row : matrix)
-    {
-        row.erase(row.begin() + nodeIndex);
-    }
-
-    nodeIndexMapping.erase(nodeItr);
+    removeFromCells(cells, nodeIndex);
+    dropTransposedCells();
 }
 
 template <GraphDirectionality directionality>
 std::string AdjMatrix<directionality>::show() const
 {
     std::stringstream out;
-    out << std::format("\nNodes amount = {}\n[\n", matrix.size());
-    for (uint32_t i = 0; i < matrix.size(); i++)
+    out << std::format("\nNodes amount = {}\n[\n", nodeIndexMapping.size());
+    for (uint32_t i = 0; i < nodeIndexMapping.size(); i++)
     {
-        for (uint32_t j = 0; j < matrix[i].size(); j++)
+        const auto* row = outgoingRow(i);
+        for (uint32_t j = 0; j < nodeIndexMapping.size(); j++)
         {
-            out << std::format("{}, ", this->matrix[i][j]);
+            out << std::format("{}, ", row[j]);
         }
         out << "\n";
     }
@@ -266,175 +375,133 @@ std::string AdjMatrix<directionality>::show() const
 template <GraphDirectionality directionality>
 uint32_t AdjMatrix<directionality>::nodesAmount() const
 {
-    return matrix.size();
+    return nodeIndexMapping.size();
 }
 
 template <GraphDirectionality directionality>
 EdgeInfo AdjMatrix<directionality>::findEdge(const EdgeInfo& edge) const
 {
-    auto sourceIterator = nodeIndexMapping.find(edge.source);
-    auto destinationIterator = nodeIndexMapping.find(edge.destination);
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    auto destinationIndex = nodeIndexMapping.indexOf(edge.destination);
 
-    if (sourceIterator == nodeIndexMapping.end() or destinationIterator == nodeIndexMapping.end())
+    if (sourceIndex == NodeIndexMapping::invalidIndex or destinationIndex == NodeIndexMapping::invalidIndex)
     {
         return {edge.source, edge.destination, std::nullopt};
     }
-    const auto& [_, sourceIndex] = *sourceIterator;
-    const auto& [_, destinationIndex] = *destinationIterator;
 
-    auto weight = matrix[sourceIndex][destinationIndex];
+    auto weight = outgoingRow(sourceIndex)[destinationIndex];
     return {edge.source, edge.destination, weight != 0 ? std::make_optional(weight) : std::nullopt};
 }
 
 template <GraphDirectionality directionality>
 std::vector<NodeId> AdjMatrix<directionality>::getNodeIds() const
 {
-    std::vector<NodeId> nodeIds = {};
-    for (const auto& [node, _] : nodeIndexMapping)
-    {
-        nodeIds.push_back(node);
-    }
-    return nodeIds;
+    return nodeIndexMapping.ids();
 }
 
 template <GraphDirectionality directionality>
 std::vector<NodeId> AdjMatrix<directionality>::getOutgoingNeighborsOf(NodeId node) const
 {
-    auto nodeIndex = nodeIndexMapping.find(node);
-    if (nodeIndex == nodeIndexMapping.end())
+    std::vector<NodeId> neighbors = {};
+    forEachOutgoingNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> AdjMatrix<directionality>::getIncommingNeighborsOf(NodeId node) const
+{
+    std::vector<NodeId> neighbors = {};
+    forEachIncommingNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    return neighbors;
+}
+
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::forEachNode(NodeVisitor visitor) const
+{
+    for (auto nodeId : nodeIndexMapping.ids())
     {
-        return {};
+        visitor(nodeId);
     }
+}
 
-    auto mappingFinder = [this](auto target) {
-        return std::ranges::find_if(nodeIndexMapping, [target](const auto& elem) {
-            auto& [_, index] = elem;
-            return index == target;
-        });
-    };
-
-    const auto& [_, index] = *nodeIndex;
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::forEachOutgoingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
 
-    std::vector<NodeId> neighbors = {};
-    for (uint32_t i = 0; i < matrix[index].size(); i++)
+    const auto* row = outgoingRow(index);
+    for (uint32_t neighborIndex = 0; neighborIndex < nodeIndexMapping.size(); neighborIndex++)
     {
-        if (matrix[index][i] != 0)
+        if (row[neighborIndex] != 0)
         {
-            const auto& [nodeId, _] = *mappingFinder(i);
-            neighbors.push_back(nodeId);
+            visitor(nodeIndexMapping.idOf(neighborIndex));
         }
     }
-    std::ranges::sort(neighbors);
-    return neighbors;
 }
 
 template <GraphDirectionality directionality>
-std::vector<NodeId> AdjMatrix<directionality>::getIncommingNeighborsOf(NodeId node) const
+void AdjMatrix<directionality>::forEachOutgoingEdge(NodeId node, EdgeVisitor visitor) const
 {
-    auto nodeIndex = nodeIndexMapping.find(node);
-    if (nodeIndex == nodeIndexMapping.end())
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
     {
-        return {};
+        return;
     }
 
-    auto mappingFinder = [this](auto target) {
-        return std::ranges::find_if(nodeIndexMapping, [target](const auto& elem) {
-            auto& [_, index] = elem;
-            return index == target;
-        });
-    };
-
-    const auto& [_, index] = *nodeIndex;
-
-    std::vector<NodeId> neighbors = {};
-    for (uint32_t i = 0; i < matrix.size(); i++)
+    const auto* row = outgoingRow(index);
+    for (uint32_t neighborIndex = 0; neighborIndex < nodeIndexMapping.size(); neighborIndex++)
     {
-        auto [mapping, _] = *mappingFinder(i);
-        if (matrix[i][index] != 0)
+        if (row[neighborIndex] != 0)
         {
-            const auto& [nodeId, _] = *mappingFinder(i);
-            neighbors.push_back(nodeId);
+            visitor(nodeIndexMapping.idOf(neighborIndex), row[neighborIndex]);
         }
     }
-    std::ranges::sort(neighbors);
-    return neighbors;
 }
 
-/*int32_t AdjMatrix::belman_ford(uint32_t vertex, bool log) {
-    // set default values for the distances and previous vertices
-    for (uint32_t i = 0; i < this->nodes_amount; i++)
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::forEachIncommingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
     {
-        this->distance[i] = 0x7FFFFFFF;
-        this->prev_node[i].clear();
+        return;
     }
 
-    // set zero as a distance for the starting vertex
-    this->distance[vertex] = 0;
-
-    bool change_found;
-
-    auto start = std::chrono::system_clock::now();
-
-    // search through the graph multiple times to find shortest paths
-    for (uint32_t i = 0; i < this->nodes_amount; i++)
+    const auto* column = incommingRow(index);
+    for (uint32_t neighborIndex = 0; neighborIndex < nodeIndexMapping.size(); neighborIndex++)
     {
-        // assume change in distance was not found
-        change_found = false;
-        for (uint32_t x = 0; x < this->nodes_amount; x++)
-        {
-            for (uint32_t j = 0; j < this->nodes_amount; j++)
-            {
-                // if change in distance between connected vertices was found, save said
-                // information
-                if (this->distance[j] > this->distance[x] + this->matrix[x][j] && this->matrix[x][j] != 0)
-                {
-                    // remember that change was found, to continue search
-                    change_found = true;
-                    this->distance[j] = this->distance[x] + this->matrix[x][j];
-                    this->prev_node[j].clear();
-                    this->prev_node[j].push_back(x);
-                }
-            }
-            // if log flag is set, print informations about distance and previous
-            // nodes
-            if (log)
-            {
-                // distance information
-                std::cout << "Distances: " << std::endl;
-                for (uint32_t j = 0; j < this->nodes_amount; j++)
-                {
-                    std::cout << this->distance[j] << ", ";
-                }
-                // previous vertices information
-                std::cout << std::endl << "Previous: " << std::endl;
-                for (uint32_t j = 0; j < this->nodes_amount; j++)
-                {
-                    for (auto itr = this->prev_node[j].begin(); itr != this->prev_node[j].end(); itr++)
-                    {
-                        std::cout << *itr << ", ";
-                    }
-                    std::cout << std::endl;
-                }
-                std::cout << std::endl;
-            }
-        }
-        // if change was not found, optimize the algorithm by stopping the search
-        if (!change_found)
+        if (column[neighborIndex] != 0)
         {
-            break;
+            visitor(nodeIndexMapping.idOf(neighborIndex));
         }
     }
+}
 
-    // calculate how long the algorithm was running
-    auto end = std::chrono::system_clock::now();
-    auto diff = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-
-    // if log flag is set, print the duration
-    if (log)
+template <GraphDirectionality directionality>
+void AdjMatrix<directionality>::forEachNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
     {
-        std::cout << "Duration: " << diff.count() << " us" << std::endl;
+        return;
     }
-    return diff.count();
-}*/
 
+    const auto* row = outgoingRow(index);
+    const auto* column = incommingRow(index);
+    for (uint32_t neighborIndex = 0; neighborIndex < nodeIndexMapping.size(); neighborIndex++)
+    {
+        if (row[neighborIndex] != 0 or column[neighborIndex] != 0)
+        {
+            visitor(nodeIndexMapping.idOf(neighborIndex));
+        }
+    }
+}
 } // namespace Graphs
@@ -5,7 +5,10 @@
 
 namespace Graphs::Algorithm
 {
-void Benchmark::run(Graphs::Graph& graph, std::string identifier, std::ostream& out, AlgorithmsCollection algorithms)
+void Benchmark::run(const Graphs::GraphReader& graph,
+                    std::string identifier,
+                    std::ostream& out,
+                    AlgorithmsCollection algorithms)
 {
     if (out.good())
     {
@@ -19,10 +22,9 @@ void Benchmark::run(Graphs::Graph& graph, std::string identifier, std::ostream&
             algorithm->operator()(graph);
             auto end = std::chrono::system_clock::now();
 
-            std::chrono::duration<double> elapsed = end - start;
-            auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+            std::chrono::duration<double, std::milli> elapsed_ms = end - start;
 
-            out << std::format("Time spent on {} algorithm: {} ms\n", algorithm->getName(), elapsed_ms.count());
+            out << std::format("Time spent on {} algorithm: {:.3f} ms\n", algorithm->getName(), elapsed_ms.count());
         }
 
         out << std::format("Benchmark of {} done\n", identifier);
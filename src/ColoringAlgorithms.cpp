@@ -1,9 +1,20 @@
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <format>
 #include <Graphs/Algorithm.hpp>
 #include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <Graphs/Orderings.hpp>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <utility>
 
 namespace Graphs::Algorithm
 {
@@ -54,97 +65,853 @@ void printPermutationOfNodes(std::ostream& out, const Permutation& nodes)
     log<isVerbose>(out, "{}\n", nodes.back());
 }
 
-ColorId colorPredicate(const ColoringInfo& info)
+/*  Greedy color assignment over dense node indices. Colors taken by neighbors of the
+    current node are stamped with the number of the current assignment, so the marker
+    buffer is reused without clearing and each assignment costs O(deg(v)).
+*/
+class GreedyColorAssigner
 {
-    auto& [_, color] = info;
-    return color;
+public:
+    explicit GreedyColorAssigner(const GraphReader& graph)
+        : graph{graph},
+          nodeIndexMapping{graph.getNodeIds()},
+          colors(nodeIndexMapping.size(), uncolored),
+          forbiddenStamps(nodeIndexMapping.size() + 1, 0)
+    {}
+
+    void assign(NodeId node, ColorId color)
+    {
+        colors[nodeIndexMapping.indexOf(node)] = color;
+    }
+
+    ColorId findAvailableColor(NodeId node)
+    {
+        ++stamp;
+        uint32_t neighborsCount = 0;
+        graph.forEachNeighbor(node, [this, &neighborsCount](NodeId neighbor) {
+            ++neighborsCount;
+            if (auto color = colors[nodeIndexMapping.indexOf(neighbor)]; color < forbiddenStamps.size())
+            {
+                forbiddenStamps[color] = stamp;
+            }
+        });
+
+        // Neighbors take at most neighborsCount colors, so one of the colors up to it is always free.
+        for (ColorId color = 0; color < neighborsCount; color++)
+        {
+            if (forbiddenStamps[color] != stamp)
+            {
+                return color;
+            }
+        }
+        return neighborsCount;
+    }
+
+private:
+    static constexpr ColorId uncolored = std::numeric_limits<ColorId>::max();
+
+    const GraphReader& graph;
+    NodeIndexMapping nodeIndexMapping;
+    std::vector<ColorId> colors;
+    std::vector<uint32_t> forbiddenStamps;
+    uint32_t stamp = 0;
+};
+
+/*  Neighbor lists translated to dense node indices once, so that algorithms scanning
+    neighborhoods repeatedly neither go through the reader interface nor the mapping.
+    Self-loops are left out, as they never constrain a coloring.
+*/
+struct DenseAdjacency
+{
+    NodeIndexMapping nodeIndexMapping;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> neighbors;
+
+    uint32_t nodesCount() const
+    {
+        return nodeIndexMapping.size();
+    }
+
+    std::span<const uint32_t> neighborsOf(uint32_t index) const
+    {
+        return {neighbors.data() + offsets[index], neighbors.data() + offsets[index + 1]};
+    }
+};
+
+DenseAdjacency buildDenseAdjacency(const GraphReader& graph, ThreadPool& threadPool)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    std::vector<uint32_t> offsets(nodeIndexMapping.size() + 1, 0);
+
+    threadPool.parallelFor(nodeIndexMapping.size(), [&](uint32_t begin, uint32_t end) {
+        for (auto index = begin; index < end; index++)
+        {
+            auto node = nodeIndexMapping.idOf(index);
+            graph.forEachNeighbor(node, [&offsets, index, node](NodeId neighbor) {
+                offsets[index + 1] += neighbor != node ? 1 : 0;
+            });
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<uint32_t> neighbors(offsets.back());
+    threadPool.parallelFor(nodeIndexMapping.size(), [&](uint32_t begin, uint32_t end) {
+        for (auto index = begin; index < end; index++)
+        {
+            auto node = nodeIndexMapping.idOf(index);
+            auto cursor = offsets[index];
+            graph.forEachNeighbor(node, [&](NodeId neighbor) {
+                if (neighbor != node)
+                {
+                    neighbors[cursor++] = nodeIndexMapping.indexOf(neighbor);
+                }
+            });
+        }
+    });
+    return {std::move(nodeIndexMapping), std::move(offsets), std::move(neighbors)};
 }
 
-ColorId findAvailableColorForCurrentNode(const Graph& graph, ColoringVector& coloring, NodeId currentNode)
+/*  Sets of colors taken by the neighbors of every node. Colors up to the degree of
+    a node - the only ones it can end up with - are kept in a bitset of its own
+    within a flat word array. Larger colors only count towards the saturation and
+    go to a small per-node overflow list.
+*/
+class NeighborColors
 {
-    auto isNeighbor = [&graph, &currentNode](auto neighbor) {
-        auto neighbors = graph.getNeighborsOf(currentNode);
-        auto& [neighborId, _] = neighbor;
+public:
+    explicit NeighborColors(const DenseAdjacency& adjacency) : wordOffsets(adjacency.nodesCount() + 1, 0)
+    {
+        for (uint32_t index = 0; index < adjacency.nodesCount(); index++)
+        {
+            auto bitsCount = adjacency.neighborsOf(index).size() + 1;
+            wordOffsets[index + 1] = wordOffsets[index] + (bitsCount + bitsPerWord - 1) / bitsPerWord;
+        }
+        words.assign(wordOffsets.back(), 0);
+        overflow.resize(adjacency.nodesCount());
+    }
 
-        return std::ranges::find(neighbors, neighborId) != neighbors.end();
-    };
+    // Returns whether the color was not present yet.
+    bool insert(uint32_t index, ColorId color)
+    {
+        auto wordIndex = wordOffsets[index] + color / bitsPerWord;
+        if (wordIndex < wordOffsets[index + 1])
+        {
+            auto mask = uint64_t{1} << (color % bitsPerWord);
+            bool isNew = (words[wordIndex] & mask) == 0;
+            words[wordIndex] |= mask;
+            return isNew;
+        }
+
+        if (std::ranges::find(overflow[index], color) != overflow[index].end())
+        {
+            return false;
+        }
+        overflow[index].push_back(color);
+        return true;
+    }
+
+    ColorId firstFreeColor(uint32_t index) const
+    {
+        for (auto wordIndex = wordOffsets[index]; wordIndex < wordOffsets[index + 1]; wordIndex++)
+        {
+            if (words[wordIndex] != ~uint64_t{0})
+            {
+                return (wordIndex - wordOffsets[index]) * bitsPerWord + std::countr_one(words[wordIndex]);
+            }
+        }
+        return (wordOffsets[index + 1] - wordOffsets[index]) * bitsPerWord;
+    }
+
+private:
+    static constexpr uint32_t bitsPerWord = 64;
+
+    std::vector<uint32_t> wordOffsets;
+    std::vector<uint64_t> words = {};
+    std::vector<std::vector<ColorId>> overflow = {};
+};
+
+// Binary max-heap of node indices, which tracks positions of the nodes so their keys can be raised in place.
+template <typename Before>
+class IndexedHeap
+{
+public:
+    IndexedHeap(uint32_t nodesCount, Before before) : positions(nodesCount), before{before}
+    {
+        heap.resize(nodesCount);
+        std::iota(heap.begin(), heap.end(), 0u);
+        std::iota(positions.begin(), positions.end(), 0u);
+        for (auto position = nodesCount / 2; position-- > 0;)
+        {
+            siftDown(position);
+        }
+    }
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    uint32_t pop()
+    {
+        auto top = heap.front();
+        moveTo(heap.back(), 0);
+        heap.pop_back();
+        if (not heap.empty())
+        {
+            siftDown(0);
+        }
+        positions[top] = removed;
+        return top;
+    }
+
+    bool contains(uint32_t index) const
+    {
+        return positions[index] != removed;
+    }
+
+    // Restores the heap order after the key of the node has grown.
+    void raised(uint32_t index)
+    {
+        auto position = positions[index];
+        while (position > 0 and before(index, heap[(position - 1) / 2]))
+        {
+            moveTo(heap[(position - 1) / 2], position);
+            position = (position - 1) / 2;
+        }
+        moveTo(index, position);
+    }
 
-    auto neighborsColoringView = coloring | std::views::filter(isNeighbor);
-    std::size_t neighborsCount = std::ranges::distance(neighborsColoringView);
+private:
+    static constexpr uint32_t removed = std::numeric_limits<uint32_t>::max();
 
-    for (const auto& color : std::views::iota(0u, neighborsCount))
+    void moveTo(uint32_t index, uint32_t position)
     {
-        if (std::ranges::find(neighborsColoringView, color, colorPredicate) == neighborsColoringView.end())
+        heap[position] = index;
+        positions[index] = position;
+    }
+
+    void siftDown(uint32_t position)
+    {
+        auto index = heap[position];
+        while (true)
         {
-            return color;
+            auto child = position * 2 + 1;
+            if (child >= heap.size())
+            {
+                break;
+            }
+            if (child + 1 < heap.size() and before(heap[child + 1], heap[child]))
+            {
+                ++child;
+            }
+            if (not before(heap[child], index))
+            {
+                break;
+            }
+            moveTo(heap[child], position);
+            position = child;
         }
+        moveTo(index, position);
     }
-    return neighborsCount + 1;
+
+    std::vector<uint32_t> heap = {};
+    std::vector<uint32_t> positions;
+    Before before;
+};
+
+Permutation createOrdering(const GraphReader& graph, NodeOrdering ordering)
+{
+    switch (ordering)
+    {
+        case NodeOrdering::largestFirst:
+            return largestFirstOrdering(graph);
+        case NodeOrdering::smallestLast:
+            return std::get<Permutation>(smallestLastOrdering(graph));
+        case NodeOrdering::natural:
+            break;
+    }
+    return graph.getNodeIds();
 }
 
-ColoringVector createColoringTable(const Permutation& nodes)
+// Smallest color not taken by any of the given colors; the buffer is reused between calls.
+template <typename ColorOf>
+ColorId firstFreeColor(std::span<const uint32_t> neighbors, std::vector<char>& taken, ColorOf colorOf)
 {
-    ColoringVector coloring = {};
-    coloring.reserve(nodes.size());
-    for (const auto& nodeId : nodes)
+    taken.assign(neighbors.size() + 1, false);
+    for (auto neighbor : neighbors)
     {
-        coloring.emplace_back(nodeId, std::numeric_limits<ColorId>::max());
+        if (auto color = colorOf(neighbor); color < taken.size())
+        {
+            taken[color] = true;
+        }
     }
-    return coloring;
+    return std::ranges::find(taken, false) - taken.begin();
+}
+
+// First-fit colors by dense index, assigned in the given order of nodes.
+std::vector<ColorId> firstFitColors(const DenseAdjacency& adjacency, const Permutation& permutation)
+{
+    std::vector<ColorId> colors(adjacency.nodesCount(), std::numeric_limits<ColorId>::max());
+    std::vector<char> taken = {};
+    for (auto node : permutation)
+    {
+        auto index = adjacency.nodeIndexMapping.indexOf(node);
+        colors[index] = firstFreeColor(adjacency.neighborsOf(index), taken, [&colors](uint32_t neighbor) {
+            return colors[neighbor];
+        });
+    }
+    return colors;
+}
+
+// Rows of the adjacency matrix as bitsets, so neighborhoods can be intersected a word at a time.
+class AdjacencyBits
+{
+public:
+    explicit AdjacencyBits(const DenseAdjacency& adjacency)
+        : wordsPerRow{(adjacency.nodesCount() + bitsPerWord - 1) / bitsPerWord},
+          words(static_cast<std::size_t>(wordsPerRow) * adjacency.nodesCount(), 0)
+    {
+        for (uint32_t index = 0; index < adjacency.nodesCount(); index++)
+        {
+            for (auto neighbor : adjacency.neighborsOf(index))
+            {
+                words[index * wordsPerRow + neighbor / bitsPerWord] |= uint64_t{1} << (neighbor % bitsPerWord);
+            }
+        }
+    }
+
+    std::span<const uint64_t> rowOf(uint32_t index) const
+    {
+        return {words.data() + static_cast<std::size_t>(index) * wordsPerRow, wordsPerRow};
+    }
+
+    static uint32_t countCommonBits(std::span<const uint64_t> lhs, std::span<const uint64_t> rhs)
+    {
+        uint32_t count = 0;
+        for (std::size_t word = 0; word < lhs.size(); word++)
+        {
+            count += std::popcount(lhs[word] & rhs[word]);
+        }
+        return count;
+    }
+
+    template <typename Visitor>
+    static void forEachBit(std::span<const uint64_t> bits, Visitor visitor)
+    {
+        for (std::size_t word = 0; word < bits.size(); word++)
+        {
+            for (auto remaining = bits[word]; remaining != 0; remaining &= remaining - 1)
+            {
+                visitor(static_cast<uint32_t>(word * bitsPerWord + std::countr_zero(remaining)));
+            }
+        }
+    }
+
+    uint32_t wordsCount() const
+    {
+        return wordsPerRow;
+    }
+
+private:
+    static constexpr uint32_t bitsPerWord = 64;
+
+    uint32_t wordsPerRow;
+    std::vector<uint64_t> words;
+};
+
+// Nodes of the highest degree, from which cliques are grown.
+std::vector<uint32_t> cliqueStarts(const DenseAdjacency& adjacency)
+{
+    constexpr uint32_t maxAttempts = 128;
+
+    std::vector<uint32_t> starts(adjacency.nodesCount());
+    std::iota(starts.begin(), starts.end(), 0u);
+    std::ranges::stable_sort(starts, std::ranges::greater{}, [&adjacency](uint32_t index) {
+        return adjacency.neighborsOf(index).size();
+    });
+    starts.resize(std::min<std::size_t>(starts.size(), maxAttempts));
+    return starts;
 }
 
-std::vector<NodeId> generateLfCompliantPermutationOfNodes(const Graph& graph, const Permutation& nodes)
+/*  Grows a clique from each of the starts without the adjacency bitsets, every time
+    adding the candidate of the highest degree. Candidates are filtered by stamping
+    the neighbors of the added node, so memory stays linear in the nodes count.
+*/
+std::vector<uint32_t> findLargeCliqueByDegree(const DenseAdjacency& adjacency)
 {
-    std::vector<NodeId> permutatedNodes = {};
-    permutatedNodes.reserve(nodes.size());
-    auto maxDeg = graph.graphDegree();
-    for (auto degree = maxDeg; degree > 0; --degree)
+    auto degreeOf = [&adjacency](uint32_t index) {
+        return adjacency.neighborsOf(index).size();
+    };
+    std::vector<uint32_t> stamps(adjacency.nodesCount(), 0);
+    uint32_t stamp = 0;
+
+    std::vector<uint32_t> largestClique = {};
+    for (auto start : cliqueStarts(adjacency))
     {
-        auto nodesWithDegree
-            = nodes | std::views::filter([degree, &graph](auto nodeId) {
-                  return std::max(graph.getOutgoingDegree(nodeId), graph.getIncommingDegree(nodeId)) == degree;
-              });
-        std::ranges::copy(nodesWithDegree, std::back_inserter(permutatedNodes));
+        if (degreeOf(start) < largestClique.size())
+        {
+            break;
+        }
+
+        std::vector<uint32_t> clique = {start};
+        std::vector<uint32_t> candidates(adjacency.neighborsOf(start).begin(), adjacency.neighborsOf(start).end());
+        while (not candidates.empty())
+        {
+            auto chosen = *std::ranges::max_element(candidates, std::ranges::less{}, degreeOf);
+            clique.push_back(chosen);
+            ++stamp;
+            for (auto neighbor : adjacency.neighborsOf(chosen))
+            {
+                stamps[neighbor] = stamp;
+            }
+            std::erase_if(candidates, [&stamps, stamp](uint32_t candidate) {
+                return stamps[candidate] != stamp;
+            });
+        }
+
+        if (clique.size() > largestClique.size())
+        {
+            largestClique = std::move(clique);
+        }
     }
+    return largestClique;
+}
+
+/*  Grows a clique from each of the nodes of the highest degree, every time adding
+    the candidate adjacent to most of the remaining candidates. Returns the largest
+    clique found, as dense indices. The adjacency bitsets take a quadratic amount of
+    memory, so larger graphs fall back to growing cliques by degree.
+*/
+std::vector<uint32_t> findLargeClique(const DenseAdjacency& adjacency)
+{
+    constexpr uint32_t maxBitsetNodes = 1u << 13;
 
-    return permutatedNodes;
+    if (adjacency.nodesCount() > maxBitsetNodes)
+    {
+        return findLargeCliqueByDegree(adjacency);
+    }
+
+    AdjacencyBits bits(adjacency);
+    auto degreeOf = [&adjacency](uint32_t index) {
+        return adjacency.neighborsOf(index).size();
+    };
+    auto starts = cliqueStarts(adjacency);
+
+    std::vector<uint32_t> largestClique = {};
+    std::vector<uint64_t> candidates(bits.wordsCount());
+    for (auto start : starts)
+    {
+        if (degreeOf(start) < largestClique.size())
+        {
+            break;
+        }
+
+        std::vector<uint32_t> clique = {start};
+        std::ranges::copy(bits.rowOf(start), candidates.begin());
+        while (std::ranges::any_of(candidates, [](uint64_t word) { return word != 0; }))
+        {
+            uint32_t chosen = 0;
+            uint32_t chosenConnections = 0;
+            bool isFirst = true;
+            AdjacencyBits::forEachBit(candidates, [&](uint32_t candidate) {
+                auto connections = AdjacencyBits::countCommonBits(candidates, bits.rowOf(candidate));
+                if (isFirst or connections > chosenConnections)
+                {
+                    chosen = candidate;
+                    chosenConnections = connections;
+                    isFirst = false;
+                }
+            });
+            clique.push_back(chosen);
+            auto chosenRow = bits.rowOf(chosen);
+            for (std::size_t word = 0; word < candidates.size(); word++)
+            {
+                candidates[word] &= chosenRow[word];
+            }
+        }
+
+        if (clique.size() > largestClique.size())
+        {
+            largestClique = std::move(clique);
+        }
+    }
+    return largestClique;
 }
 
-std::vector<NodeId> generateSlCompliantPermutationOfNodes(const Graph& graph, const Permutation& nodes)
+using Assignments = std::vector<std::pair<uint32_t, ColorId>>;
+
+// Positions of the nodes in the order of decreasing degree, ties broken by the lower index.
+struct DegreeRanks
+{
+    explicit DegreeRanks(const DenseAdjacency& adjacency)
+        : nodeOfRank(adjacency.nodesCount()), rankOf(adjacency.nodesCount())
+    {
+        std::iota(nodeOfRank.begin(), nodeOfRank.end(), 0u);
+        std::ranges::stable_sort(nodeOfRank, std::ranges::greater{}, [&adjacency](uint32_t index) {
+            return adjacency.neighborsOf(index).size();
+        });
+        for (uint32_t rank = 0; rank < nodeOfRank.size(); rank++)
+        {
+            rankOf[nodeOfRank[rank]] = rank;
+        }
+    }
+
+    std::vector<uint32_t> nodeOfRank;
+    std::vector<uint32_t> rankOf;
+};
+
+/*  Coloring under construction in the branch-and-bound search. For every node it
+    counts the neighbors having each of the colors, which keeps both the saturation
+    and the feasibility of a color available in constant time, and undoing an
+    assignment exact. Uncolored nodes are bucketed by saturation, each bucket being
+    a bitset over degree ranks, so the node to branch on is the first bit of the
+    highest non-empty bucket.
+*/
+class PartialColoring
+{
+public:
+    static constexpr ColorId uncolored = std::numeric_limits<ColorId>::max();
+
+    PartialColoring(const DenseAdjacency& adjacency, const DegreeRanks& ranks, uint32_t colorsLimit)
+        : adjacency{adjacency},
+          ranks{ranks},
+          colorsLimit{colorsLimit},
+          colors(adjacency.nodesCount(), uncolored),
+          neighborColorCounts(static_cast<std::size_t>(adjacency.nodesCount()) * colorsLimit, 0),
+          saturations(adjacency.nodesCount(), 0),
+          nodesWithColor(colorsLimit, 0),
+          wordsPerBucket{(adjacency.nodesCount() + bitsPerWord - 1) / bitsPerWord},
+          buckets(static_cast<std::size_t>(colorsLimit + 1) * wordsPerBucket, 0),
+          bucketSizes(colorsLimit + 1, 0)
+    {
+        for (uint32_t index = 0; index < adjacency.nodesCount(); index++)
+        {
+            insertUncolored(index);
+        }
+    }
+
+    bool isComplete() const
+    {
+        return coloredCount == colors.size();
+    }
+
+    uint32_t usedColors() const
+    {
+        return usedColorsCount;
+    }
+
+    bool canTake(uint32_t index, ColorId color) const
+    {
+        return neighborColorCounts[countOffset(index, color)] == 0;
+    }
+
+    const std::vector<ColorId>& colorsByIndex() const
+    {
+        return colors;
+    }
+
+    void assign(uint32_t index, ColorId color)
+    {
+        removeUncolored(index);
+        colors[index] = color;
+        ++coloredCount;
+        if (nodesWithColor[color]++ == 0)
+        {
+            ++usedColorsCount;
+        }
+        for (auto neighbor : adjacency.neighborsOf(index))
+        {
+            if (neighborColorCounts[countOffset(neighbor, color)]++ == 0)
+            {
+                changeSaturation(neighbor, saturations[neighbor] + 1);
+            }
+        }
+    }
+
+    void unassign(uint32_t index)
+    {
+        auto color = std::exchange(colors[index], uncolored);
+        --coloredCount;
+        if (--nodesWithColor[color] == 0)
+        {
+            --usedColorsCount;
+        }
+        for (auto neighbor : adjacency.neighborsOf(index))
+        {
+            if (--neighborColorCounts[countOffset(neighbor, color)] == 0)
+            {
+                changeSaturation(neighbor, saturations[neighbor] - 1);
+            }
+        }
+        insertUncolored(index);
+    }
+
+    void apply(const Assignments& assignments)
+    {
+        for (auto [index, color] : assignments)
+        {
+            assign(index, color);
+        }
+    }
+
+    // Uncolored node of the highest saturation, then of the highest degree.
+    uint32_t selectNode() const
+    {
+        const auto* bucket = buckets.data() + static_cast<std::size_t>(highestBucket) * wordsPerBucket;
+        auto word = std::ranges::find_if(bucket, bucket + wordsPerBucket, [](uint64_t bits) {
+            return bits != 0;
+        });
+        auto rank = static_cast<uint32_t>(word - bucket) * bitsPerWord + std::countr_zero(*word);
+        return ranks.nodeOfRank[rank];
+    }
+
+private:
+    static constexpr uint32_t bitsPerWord = 64;
+
+    std::size_t countOffset(uint32_t index, ColorId color) const
+    {
+        return static_cast<std::size_t>(index) * colorsLimit + color;
+    }
+
+    uint64_t& bucketWord(uint32_t saturation, uint32_t rank)
+    {
+        return buckets[static_cast<std::size_t>(saturation) * wordsPerBucket + rank / bitsPerWord];
+    }
+
+    void insertUncolored(uint32_t index)
+    {
+        auto rank = ranks.rankOf[index];
+        bucketWord(saturations[index], rank) |= uint64_t{1} << (rank % bitsPerWord);
+        ++bucketSizes[saturations[index]];
+        highestBucket = std::max(highestBucket, saturations[index]);
+    }
+
+    void removeUncolored(uint32_t index)
+    {
+        auto rank = ranks.rankOf[index];
+        bucketWord(saturations[index], rank) &= ~(uint64_t{1} << (rank % bitsPerWord));
+        --bucketSizes[saturations[index]];
+        while (highestBucket > 0 and bucketSizes[highestBucket] == 0)
+        {
+            --highestBucket;
+        }
+    }
+
+    // Colored nodes keep their saturation up to date too, but only uncolored ones sit in the buckets.
+    void changeSaturation(uint32_t index, uint32_t saturation)
+    {
+        if (colors[index] != uncolored)
+        {
+            saturations[index] = saturation;
+            return;
+        }
+        removeUncolored(index);
+        saturations[index] = saturation;
+        insertUncolored(index);
+    }
+
+    const DenseAdjacency& adjacency;
+    const DegreeRanks& ranks;
+    uint32_t colorsLimit;
+    std::vector<ColorId> colors;
+    std::vector<uint32_t> neighborColorCounts;
+    std::vector<uint32_t> saturations;
+    std::vector<uint32_t> nodesWithColor;
+    uint32_t wordsPerBucket;
+    std::vector<uint64_t> buckets;
+    std::vector<uint32_t> bucketSizes;
+    uint32_t highestBucket = 0;
+    uint32_t coloredCount = 0;
+    uint32_t usedColorsCount = 0;
+};
+
+/*  DSatur branch-and-bound shared by all threads of the search. The best coloring
+    is only replaced under the lock, but its colors count is read without it to
+    prune, so a thread may briefly explore a subtree another one already beat.
+*/
+class ColoringSearch
 {
-    std::vector<NodeId> permutatedNodes = {};
-    permutatedNodes.reserve(nodes.size());
+public:
+    ColoringSearch(const DenseAdjacency& adjacency,
+                   uint32_t lowerBound,
+                   std::vector<ColorId> initialColoring,
+                   const SearchBudget& budget)
+        : adjacency{adjacency},
+          ranks{adjacency},
+          lowerBound{lowerBound},
+          colorsLimit{std::ranges::max(initialColoring) + 1},
+          bestColorsCount{colorsLimit},
+          bestColoring{std::move(initialColoring)},
+          maxBranches{budget.maxBranches},
+          deadline{deadlineAfter(budget.timeLimit)}
+    {
+        finished = bestColorsCount <= lowerBound;
+    }
+
+    // Expands the search tree breadth-first until there are enough subtrees to spread among the threads.
+    std::vector<Assignments> split(const Assignments& root, std::size_t targetCount) const
+    {
+        std::vector<Assignments> frontier = {root};
+        bool isExpanded = true;
+        while (frontier.size() < targetCount and isExpanded)
+        {
+            isExpanded = false;
+            std::vector<Assignments> nextFrontier = {};
+            for (const auto& prefix : frontier)
+            {
+                PartialColoring coloring(adjacency, ranks, colorsLimit);
+                coloring.apply(prefix);
+                if (coloring.isComplete())
+                {
+                    nextFrontier.push_back(prefix);
+                    continue;
+                }
+
+                isExpanded = true;
+                auto index = coloring.selectNode();
+                forEachCandidateColor(coloring, index, [&](ColorId color) {
+                    nextFrontier.push_back(prefix);
+                    nextFrontier.back().emplace_back(index, color);
+                });
+            }
+            frontier = std::move(nextFrontier);
+        }
+        return frontier;
+    }
+
+    void explore(const Assignments& subtree)
+    {
+        PartialColoring coloring(adjacency, ranks, colorsLimit);
+        coloring.apply(subtree);
+        explore(coloring);
+    }
 
-    using DegreeInfo = std::pair<NodeId, uint32_t>;
-    auto adjustedDegrees = std::vector<DegreeInfo>{nodes.size()};
+    bool isOptimal() const
+    {
+        return not budgetExceeded.load(std::memory_order_relaxed);
+    }
 
-    for (auto& [nodeId, degree] : adjustedDegrees)
+    uint64_t branchesCount() const
     {
-        degree = std::max(graph.getOutgoingDegree(nodeId), graph.getIncommingDegree(nodeId));
+        return branches.load(std::memory_order_relaxed);
     }
 
-    for (std::size_t i = 0; i < nodes.size(); ++i)
+    uint32_t colorsCount() const
     {
-        auto& [minDegreeNodeId, foundDegree]
-            = *std::ranges::min_element(adjustedDegrees, [](const auto& lhs, const auto& rhs) {
-                  return lhs.second < rhs.second;
-              });
+        return bestColorsCount.load(std::memory_order_relaxed);
+    }
 
-        permutatedNodes.push_back(minDegreeNodeId);
-        foundDegree = std::numeric_limits<uint32_t>::max();
+    const std::vector<ColorId>& coloring() const
+    {
+        return bestColoring;
+    }
 
-        auto neighbors = graph.getNeighborsOf(minDegreeNodeId);
-        for (auto& [nodeId, degree] : adjustedDegrees)
+private:
+    static std::chrono::steady_clock::time_point deadlineAfter(std::chrono::milliseconds timeLimit)
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto timeLeft = std::chrono::steady_clock::time_point::max() - now;
+        if (timeLimit >= std::chrono::duration_cast<std::chrono::milliseconds>(timeLeft))
         {
-            if (std::ranges::find(neighbors, nodeId) != neighbors.end())
+            return std::chrono::steady_clock::time_point::max();
+        }
+        return now + timeLimit;
+    }
+
+    // Colors worth trying for the node: free ones already in use, then a single new one, while below the best count.
+    template <typename Visitor>
+    void forEachCandidateColor(const PartialColoring& coloring, uint32_t index, Visitor visitor) const
+    {
+        for (ColorId color = 0; color <= coloring.usedColors(); color++)
+        {
+            if (color + 1 >= bestColorsCount.load(std::memory_order_relaxed))
             {
-                degree--;
+                return;
+            }
+            if (coloring.canTake(index, color))
+            {
+                visitor(color);
             }
         }
     }
 
-    std::reverse(permutatedNodes.begin(), permutatedNodes.end());
-    return permutatedNodes;
+    bool shouldStop()
+    {
+        constexpr uint64_t branchesBetweenClockChecks = 1024;
+
+        if (finished.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        auto branch = branches.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (branch > maxBranches
+            or (branch % branchesBetweenClockChecks == 0 and std::chrono::steady_clock::now() > deadline))
+        {
+            budgetExceeded.store(true, std::memory_order_relaxed);
+            finished.store(true, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void record(const PartialColoring& coloring)
+    {
+        std::scoped_lock lock{bestMutex};
+        if (coloring.usedColors() >= bestColorsCount.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        bestColoring = coloring.colorsByIndex();
+        bestColorsCount.store(coloring.usedColors(), std::memory_order_relaxed);
+        if (coloring.usedColors() <= lowerBound)
+        {
+            finished.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    void explore(PartialColoring& coloring)
+    {
+        if (shouldStop() or coloring.usedColors() >= bestColorsCount.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        if (coloring.isComplete())
+        {
+            record(coloring);
+            return;
+        }
+
+        auto index = coloring.selectNode();
+        forEachCandidateColor(coloring, index, [&](ColorId color) {
+            coloring.assign(index, color);
+            explore(coloring);
+            coloring.unassign(index);
+        });
+    }
+
+    const DenseAdjacency& adjacency;
+    DegreeRanks ranks;
+    uint32_t lowerBound;
+    uint32_t colorsLimit;
+    std::atomic<uint32_t> bestColorsCount;
+    std::mutex bestMutex = {};
+    std::vector<ColorId> bestColoring;
+    uint64_t maxBranches;
+    std::chrono::steady_clock::time_point deadline;
+    std::atomic<uint64_t> branches = 0;
+    std::atomic<bool> budgetExceeded = false;
+    std::atomic<bool> finished = false;
+};
+
+ColoringVector createColoringTable(const Permutation& nodes)
+{
+    ColoringVector coloring = {};
+    coloring.reserve(nodes.size());
+    for (const auto& nodeId : nodes)
+    {
+        coloring.emplace_back(nodeId, std::numeric_limits<ColorId>::max());
+    }
+    return coloring;
 }
 
 ColoringResult resizeAndInitializeResultStructure(const Permutation& nodes)
@@ -156,36 +923,41 @@ ColoringResult resizeAndInitializeResultStructure(const Permutation& nodes)
 }
 
 template <bool isVerbose>
-ColoringResult performCoreColoring(std::ostream& outStream, const Graph& graph, const Permutation& permutation)
+ColoringResult performCoreColoring(std::ostream& outStream, const GraphReader& graph, const Permutation& permutation)
 {
     log<isVerbose>(outStream, "Generated permutation of nodes: ");
     printPermutationOfNodes<isVerbose>(outStream, permutation);
 
     ColoringResult result = {};
-    log<isVerbose>(*outStream, "{}\n", permutation.size());
-    result = resizeAndInitializeResultStructure(nodes);
+    if (permutation.empty())
+    {
+        return result;
+    }
+    result = resizeAndInitializeResultStructure(permutation);
 
     auto& [maxColor, coloring] = result;
     auto& [frontNodeId, frontNodeColor] = coloring.front();
     frontNodeColor = 0u;
 
-    log<isVerbose>(*outStream, "Coloring node {} with color {}\n", frontNodeId, frontNodeColor);
+    GreedyColorAssigner assigner(graph);
+    assigner.assign(frontNodeId, frontNodeColor);
+
+    log<isVerbose>(outStream, "Coloring node {} with color {}\n", frontNodeId, frontNodeColor);
 
     for (auto& [nodeId, nodeColor] : coloring | std::views::drop(1))
     {
-        nodeColor = findAvailableColorForCurrentNode(graph, coloring, nodeId);
-        log<isVerbose>(*outStream, "Coloring node {} with color {}\n", nodeId, nodeColor);
+        nodeColor = assigner.findAvailableColor(nodeId);
+        assigner.assign(nodeId, nodeColor);
+        maxColor = std::max(maxColor, nodeColor);
+        log<isVerbose>(outStream, "Coloring node {} with color {}\n", nodeId, nodeColor);
     }
 
-    auto [_, maxColorId] = std::ranges::max(coloring, std::ranges::less{}, colorPredicate);
-    maxColor = maxColorId;
-
     return result;
 }
 } // namespace
 
 template <bool isVerbose>
-void GreedyColoring<isVerbose>::operator()(const Graphs::Graph& graph)
+void GreedyColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
 {
     if (graph.getNodeIds().empty())
     {
@@ -196,7 +968,7 @@ void GreedyColoring<isVerbose>::operator()(const Graphs::Graph& graph)
     log<isVerbose>(*outStream, "Greedy coloring graph with {} nodes\n", graph.nodesAmount());
     Permutation nodes = graph.getNodeIds();
 
-    *result = performCoreColoring(*outStream, graph, nodes);
+    *result = performCoreColoring<isVerbose>(*outStream, graph, nodes);
 
     log<isVerbose>(*outStream, "Greedy coloring completed\n");
 }
@@ -222,19 +994,18 @@ template class GreedyColoring<verbose>;
 template class GreedyColoring<notVerbose>;
 
 template <bool isVerbose>
-void LfColoring<isVerbose>::operator()(const Graphs::Graph&)
+void LfColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
 {
-    if (nodes.empty())
+    if (graph.nodesAmount() == 0)
     {
         log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
         return;
     }
 
     log<isVerbose>(*outStream, "LF coloring graph with {} nodes\n", graph.nodesAmount());
-    auto& nodes = graph.getNodeIds();
 
-    auto permutatedNodes = generateLfCompliantPermutationOfNodes(nodes);
-    *result = performCoreColoring(*outStream, graph, permutatedNodes);
+    auto permutatedNodes = largestFirstOrdering(graph);
+    *result = performCoreColoring<isVerbose>(*outStream, graph, permutatedNodes);
 
     log<isVerbose>(*outStream, "LF coloring completed\n");
 }
@@ -260,19 +1031,19 @@ template class LfColoring<verbose>;
 template class LfColoring<notVerbose>;
 
 template <bool isVerbose>
-void SlColoring<isVerbose>::operator()(const Graphs::Graph& graph)
+void SlColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
 {
-    if (nodes.empty())
+    if (graph.nodesAmount() == 0)
     {
         log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
         return;
     }
 
     log<isVerbose>(*outStream, "SL coloring graph with {} nodes\n", graph.nodesAmount());
-    auto& nodes = graph.getNodeIds();
 
-    auto permutatedNodes = generateSlCompliantPermutationOfNodes(nodes);
-    *result = performCoreColoring(*outStream, graph, permutatedNodes);
+    auto [permutatedNodes, degeneracy, _] = smallestLastOrdering(graph);
+    log<isVerbose>(*outStream, "Graph degeneracy is {}\n", degeneracy);
+    *result = performCoreColoring<isVerbose>(*outStream, graph, permutatedNodes);
 
     log<isVerbose>(*outStream, "SL coloring completed\n");
 }
@@ -293,4 +1064,395 @@ std::string SlColoring<isVerbose>::getName()
 {
     return "SL coloring";
 }
+
+template class SlColoring<verbose>;
+template class SlColoring<notVerbose>;
+
+template <bool isVerbose>
+void DSaturColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    if (graph.nodesAmount() == 0)
+    {
+        log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
+        return;
+    }
+
+    log<isVerbose>(*outStream, "DSatur coloring graph with {} nodes\n", graph.nodesAmount());
+
+    ThreadPool callingThreadOnly(1);
+    auto adjacency = buildDenseAdjacency(graph, callingThreadOnly);
+    auto nodesCount = adjacency.nodesCount();
+
+    NeighborColors neighborColors(adjacency);
+    std::vector<uint32_t> saturations(nodesCount, 0);
+    auto before = [&adjacency, &saturations](uint32_t lhs, uint32_t rhs) {
+        if (saturations[lhs] != saturations[rhs])
+        {
+            return saturations[lhs] > saturations[rhs];
+        }
+        auto lhsDegree = adjacency.neighborsOf(lhs).size();
+        auto rhsDegree = adjacency.neighborsOf(rhs).size();
+        return lhsDegree != rhsDegree ? lhsDegree > rhsDegree : lhs < rhs;
+    };
+    IndexedHeap queue(nodesCount, before);
+
+    auto& [maxColor, coloring] = *result;
+    maxColor = std::numeric_limits<ColorId>::min();
+    coloring.clear();
+    coloring.reserve(nodesCount);
+
+    while (not queue.empty())
+    {
+        auto index = queue.pop();
+        auto color = neighborColors.firstFreeColor(index);
+        coloring.emplace_back(adjacency.nodeIndexMapping.idOf(index), color);
+        maxColor = std::max(maxColor, color);
+        log<isVerbose>(*outStream,
+                       "Coloring node {} with color {}, saturation {}\n",
+                       adjacency.nodeIndexMapping.idOf(index),
+                       color,
+                       saturations[index]);
+
+        for (auto neighbor : adjacency.neighborsOf(index))
+        {
+            if (queue.contains(neighbor) and neighborColors.insert(neighbor, color))
+            {
+                ++saturations[neighbor];
+                queue.raised(neighbor);
+            }
+        }
+    }
+
+    log<isVerbose>(*outStream, "DSatur coloring completed\n");
+}
+
+template <bool isVerbose>
+DSaturColoring<isVerbose>::DSaturColoring(std::shared_ptr<ColoringResult> resultContainer, std::ostream& out)
+    : result(std::move(resultContainer)), outStream{&out, ostreamDeleter}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Coloring result cannot be null");
+        throw std::invalid_argument{"Coloring result cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string DSaturColoring<isVerbose>::getName()
+{
+    return "DSatur coloring";
+}
+
+template class DSaturColoring<verbose>;
+template class DSaturColoring<notVerbose>;
+
+template <bool isVerbose>
+void ParallelColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    if (graph.nodesAmount() == 0)
+    {
+        log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
+        return;
+    }
+
+    log<isVerbose>(*outStream,
+                   "Parallel coloring graph with {} nodes using {} threads\n",
+                   graph.nodesAmount(),
+                   threadPool.size());
+
+    auto adjacency = buildDenseAdjacency(graph, threadPool);
+    auto nodesCount = adjacency.nodesCount();
+    constexpr auto uncolored = std::numeric_limits<ColorId>::max();
+
+    // A random permutation of indices, so priorities are unique and no ties have to be broken.
+    std::vector<uint32_t> priorities(nodesCount);
+    std::iota(priorities.begin(), priorities.end(), 0u);
+    std::ranges::shuffle(priorities, std::mt19937_64{seed});
+
+    std::vector<ColorId> colors(nodesCount, uncolored);
+    std::vector<uint32_t> uncoloredNodes(nodesCount);
+    std::iota(uncoloredNodes.begin(), uncoloredNodes.end(), 0u);
+    std::vector<char> selected(nodesCount);
+
+    uint32_t rounds = 0;
+    while (not uncoloredNodes.empty())
+    {
+        ++rounds;
+
+        // Selecting and coloring run as separate passes, so colors are never written while being compared.
+        threadPool.parallelFor(uncoloredNodes.size(), [&](uint32_t begin, uint32_t end) {
+            for (auto position = begin; position < end; position++)
+            {
+                auto node = uncoloredNodes[position];
+                selected[position] = std::ranges::none_of(adjacency.neighborsOf(node), [&](uint32_t neighbor) {
+                    return colors[neighbor] == uncolored and priorities[neighbor] > priorities[node];
+                });
+            }
+        });
+
+        // Selected nodes are pairwise non-adjacent, so none of them reads a color written in this pass.
+        threadPool.parallelFor(uncoloredNodes.size(), [&](uint32_t begin, uint32_t end) {
+            std::vector<char> taken = {};
+            for (auto position = begin; position < end; position++)
+            {
+                if (not selected[position])
+                {
+                    continue;
+                }
+
+                auto node = uncoloredNodes[position];
+                colors[node] = firstFreeColor(adjacency.neighborsOf(node), taken, [&colors](uint32_t neighbor) {
+                    return colors[neighbor];
+                });
+            }
+        });
+
+        std::size_t remaining = 0;
+        for (std::size_t position = 0; position < uncoloredNodes.size(); position++)
+        {
+            if (not selected[position])
+            {
+                uncoloredNodes[remaining++] = uncoloredNodes[position];
+            }
+        }
+        uncoloredNodes.resize(remaining);
+    }
+
+    auto& [maxColor, coloring] = *result;
+    maxColor = std::numeric_limits<ColorId>::min();
+    coloring.clear();
+    coloring.reserve(nodesCount);
+    for (uint32_t index = 0; index < nodesCount; index++)
+    {
+        coloring.emplace_back(adjacency.nodeIndexMapping.idOf(index), colors[index]);
+        maxColor = std::max(maxColor, colors[index]);
+    }
+
+    log<isVerbose>(*outStream, "Parallel coloring completed in {} rounds\n", rounds);
+}
+
+template <bool isVerbose>
+ParallelColoring<isVerbose>::ParallelColoring(std::shared_ptr<ColoringResult> resultContainer,
+                                              std::ostream& out,
+                                              uint32_t threadsCount,
+                                              uint64_t seed)
+    : result(std::move(resultContainer)), outStream{&out, ostreamDeleter}, threadPool{threadsCount}, seed{seed}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Coloring result cannot be null");
+        throw std::invalid_argument{"Coloring result cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string ParallelColoring<isVerbose>::getName()
+{
+    return "Parallel coloring";
+}
+
+template class ParallelColoring<verbose>;
+template class ParallelColoring<notVerbose>;
+
+template <bool isVerbose>
+void SpeculativeColoring<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    if (graph.nodesAmount() == 0)
+    {
+        log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
+        return;
+    }
+
+    log<isVerbose>(*outStream,
+                   "Speculative coloring graph with {} nodes using {} threads\n",
+                   graph.nodesAmount(),
+                   threadPool.size());
+
+    auto adjacency = buildDenseAdjacency(graph, threadPool);
+    auto nodesCount = adjacency.nodesCount();
+    auto permutation = createOrdering(graph, ordering);
+    log<isVerbose>(*outStream, "Generated permutation of nodes: ");
+    printPermutationOfNodes<isVerbose>(*outStream, permutation);
+
+    std::vector<uint32_t> ranks(nodesCount);
+    std::vector<uint32_t> pendingNodes = {};
+    pendingNodes.reserve(nodesCount);
+    for (auto node : permutation)
+    {
+        auto index = adjacency.nodeIndexMapping.indexOf(node);
+        ranks[index] = pendingNodes.size();
+        pendingNodes.push_back(index);
+    }
+
+    // Neighbors are read while other threads color them, hence atomics; relaxed order is enough as
+    // any stale color read is caught by the detection pass.
+    std::vector<std::atomic<ColorId>> colors(nodesCount);
+    for (auto& color : colors)
+    {
+        color.store(std::numeric_limits<ColorId>::max(), std::memory_order_relaxed);
+    }
+    auto colorOf = [&colors](uint32_t index) {
+        return colors[index].load(std::memory_order_relaxed);
+    };
+    std::vector<char> conflicting(nodesCount);
+
+    uint32_t rounds = 0;
+    while (not pendingNodes.empty())
+    {
+        ++rounds;
+
+        threadPool.parallelFor(pendingNodes.size(), [&](uint32_t begin, uint32_t end) {
+            std::vector<char> taken = {};
+            for (auto position = begin; position < end; position++)
+            {
+                auto node = pendingNodes[position];
+                colors[node].store(firstFreeColor(adjacency.neighborsOf(node), taken, colorOf),
+                                   std::memory_order_relaxed);
+            }
+        });
+
+        // Of two adjacent nodes with equal colors only the later one in the ordering is recolored,
+        // so the earliest pending node always keeps its color and every round makes progress.
+        threadPool.parallelFor(pendingNodes.size(), [&](uint32_t begin, uint32_t end) {
+            for (auto position = begin; position < end; position++)
+            {
+                auto node = pendingNodes[position];
+                conflicting[position] = std::ranges::any_of(adjacency.neighborsOf(node), [&](uint32_t neighbor) {
+                    return colorOf(neighbor) == colorOf(node) and ranks[neighbor] < ranks[node];
+                });
+            }
+        });
+
+        std::size_t remaining = 0;
+        for (std::size_t position = 0; position < pendingNodes.size(); position++)
+        {
+            if (conflicting[position])
+            {
+                pendingNodes[remaining++] = pendingNodes[position];
+            }
+        }
+        pendingNodes.resize(remaining);
+        log<isVerbose>(*outStream, "Round {} left {} conflicting nodes\n", rounds, remaining);
+    }
+
+    auto& [maxColor, coloring] = *result;
+    maxColor = std::numeric_limits<ColorId>::min();
+    coloring.clear();
+    coloring.reserve(nodesCount);
+    for (auto node : permutation)
+    {
+        auto color = colorOf(adjacency.nodeIndexMapping.indexOf(node));
+        coloring.emplace_back(node, color);
+        maxColor = std::max(maxColor, color);
+    }
+
+    log<isVerbose>(*outStream, "Speculative coloring completed in {} rounds\n", rounds);
+}
+
+template <bool isVerbose>
+SpeculativeColoring<isVerbose>::SpeculativeColoring(std::shared_ptr<ColoringResult> resultContainer,
+                                                    std::ostream& out,
+                                                    NodeOrdering ordering,
+                                                    uint32_t threadsCount)
+    : result(std::move(resultContainer)), outStream{&out, ostreamDeleter}, threadPool{threadsCount}, ordering{ordering}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Coloring result cannot be null");
+        throw std::invalid_argument{"Coloring result cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string SpeculativeColoring<isVerbose>::getName()
+{
+    return "Speculative coloring";
+}
+
+template class SpeculativeColoring<verbose>;
+template class SpeculativeColoring<notVerbose>;
+
+template <bool isVerbose>
+void ChromaticNumber<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    if (graph.nodesAmount() == 0)
+    {
+        log<isVerbose>(*outStream, "Graph is empty, coloring is not possible\n");
+        return;
+    }
+
+    log<isVerbose>(*outStream,
+                   "Searching chromatic number of graph with {} nodes using {} threads\n",
+                   graph.nodesAmount(),
+                   threadPool.size());
+
+    auto adjacency = buildDenseAdjacency(graph, threadPool);
+    auto clique = findLargeClique(adjacency);
+    log<isVerbose>(*outStream, "Found clique of {} nodes\n", clique.size());
+
+    auto largestFirstColors = firstFitColors(adjacency, largestFirstOrdering(graph));
+    auto smallestLastColors = firstFitColors(adjacency, std::get<Permutation>(smallestLastOrdering(graph)));
+    auto initialColoring = std::ranges::max(largestFirstColors) <= std::ranges::max(smallestLastColors)
+                               ? std::move(largestFirstColors)
+                               : std::move(smallestLastColors);
+    log<isVerbose>(*outStream, "Heuristic coloring uses {} colors\n", std::ranges::max(initialColoring) + 1);
+
+    ColoringSearch search(adjacency, clique.size(), std::move(initialColoring), budget);
+
+    // Colors of a clique are interchangeable, so fixing them up front removes symmetric subtrees.
+    Assignments root = {};
+    for (ColorId color = 0; color < clique.size(); color++)
+    {
+        root.emplace_back(clique[color], color);
+    }
+    constexpr uint32_t subtreesPerThread = 8;
+    auto subtrees = search.split(root, threadPool.size() > 1 ? threadPool.size() * subtreesPerThread : 1);
+    log<isVerbose>(*outStream, "Exploring {} subtrees\n", subtrees.size());
+
+    threadPool.parallelFor(subtrees.size(), [&search, &subtrees](uint32_t begin, uint32_t end) {
+        for (auto subtree = begin; subtree < end; subtree++)
+        {
+            search.explore(subtrees[subtree]);
+        }
+    });
+
+    auto& [lowerBound, colorsCount, coloring] = *result;
+    colorsCount = search.colorsCount();
+    lowerBound = search.isOptimal() ? colorsCount : static_cast<uint32_t>(clique.size());
+    coloring.clear();
+    coloring.reserve(adjacency.nodesCount());
+    for (uint32_t index = 0; index < adjacency.nodesCount(); index++)
+    {
+        coloring.emplace_back(adjacency.nodeIndexMapping.idOf(index), search.coloring()[index]);
+    }
+
+    log<isVerbose>(*outStream,
+                   "Search visited {} branches, {} colors are {}\n",
+                   search.branchesCount(),
+                   colorsCount,
+                   search.isOptimal() ? "optimal" : "the best found within the budget");
+}
+
+template <bool isVerbose>
+ChromaticNumber<isVerbose>::ChromaticNumber(std::shared_ptr<ChromaticNumberResult> resultContainer,
+                                            std::ostream& out,
+                                            SearchBudget budget,
+                                            uint32_t threadsCount)
+    : result(std::move(resultContainer)), outStream{&out, ostreamDeleter}, threadPool{threadsCount}, budget{budget}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Chromatic number result cannot be null");
+        throw std::invalid_argument{"Chromatic number result cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string ChromaticNumber<isVerbose>::getName()
+{
+    return "Chromatic number";
+}
+
+template class ChromaticNumber<verbose>;
+template class ChromaticNumber<notVerbose>;
 } // namespace Graphs::Algorithm
@@ -0,0 +1,396 @@
+#include <algorithm>
+#include <format>
+#include <Graphs/CsrGraph.hpp>
+#include <numeric>
+#include <sstream>
+
+namespace Graphs
+{
+template <GraphDirectionality directionality>
+CsrGraph<directionality>::CsrGraph(const GraphReader& graph)
+{
+    build(graph.getNodeIds(), graph.getEdges());
+}
+
+template <GraphDirectionality directionality>
+CsrGraph<directionality>::CsrGraph(uint32_t nodesAmount, const std::vector<EdgeInfo>& edges)
+{
+    std::vector<NodeId> ids(nodesAmount);
+    std::iota(ids.begin(), ids.end(), 1u);
+    build(std::move(ids), edges);
+}
+
+template <GraphDirectionality directionality>
+CsrGraph<directionality>::CsrGraph(std::vector<uint32_t> offsets,
+                                   std::vector<NodeId> neighbors,
+                                   std::vector<WeightType> weights)
+    : offsets(std::move(offsets)), neighbors(std::move(neighbors)), weights(std::move(weights))
+{
+    std::vector<NodeId> ids(this->offsets.size() - 1);
+    std::iota(ids.begin(), ids.end(), 1u);
+    nodeIndexMapping = NodeIndexMapping(std::move(ids));
+
+    if (std::ranges::all_of(this->weights, [](auto weight) { return weight == 1; }))
+    {
+        this->weights.clear();
+    }
+
+    buildIncommingRows();
+    computeGraphDegree();
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::build(std::vector<NodeId> ids, const std::vector<EdgeInfo>& edges)
+{
+    std::ranges::sort(ids);
+    auto [first, last] = std::ranges::unique(ids);
+    ids.erase(first, last);
+    nodeIndexMapping = NodeIndexMapping(std::move(ids));
+
+    auto forEachArc = [this, &edges](auto visitor) {
+        for (const auto& [source, destination, weight] : edges)
+        {
+            auto sourceIndex = nodeIndexMapping.indexOf(source);
+            auto destinationIndex = nodeIndexMapping.indexOf(destination);
+            if (sourceIndex == NodeIndexMapping::invalidIndex or destinationIndex == NodeIndexMapping::invalidIndex)
+            {
+                continue;
+            }
+            visitor(sourceIndex, destination, weight.value_or(1));
+            if constexpr (directionality == GraphDirectionality::undirected)
+            {
+                if (source != destination)
+                {
+                    visitor(destinationIndex, source, weight.value_or(1));
+                }
+            }
+        }
+    };
+
+    std::vector<uint32_t> rowBounds(nodeIndexMapping.size() + 1, 0);
+    forEachArc([&rowBounds](uint32_t sourceIndex, NodeId, WeightType) {
+        ++rowBounds[sourceIndex + 1];
+    });
+    std::partial_sum(rowBounds.begin(), rowBounds.end(), rowBounds.begin());
+
+    using Arc = std::pair<NodeId, WeightType>;
+    std::vector<Arc> arcs(rowBounds.back());
+    auto cursors = rowBounds;
+    forEachArc([&arcs, &cursors](uint32_t sourceIndex, NodeId destination, WeightType weight) {
+        arcs[cursors[sourceIndex]++] = {destination, weight};
+    });
+
+    // Rows are sorted by destination, and repeated edges collapse onto the last weight given,
+    // the same way consecutive setEdge calls overwrite each other on the mutable representations.
+    offsets.assign(nodeIndexMapping.size() + 1, 0);
+    neighbors.clear();
+    neighbors.reserve(arcs.size());
+    weights.clear();
+    weights.reserve(arcs.size());
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); ++index)
+    {
+        auto row = std::ranges::subrange(arcs.begin() + rowBounds[index], arcs.begin() + rowBounds[index + 1]);
+        std::ranges::stable_sort(row, std::less<>(), &Arc::first);
+        for (auto itr = row.begin(); itr != row.end(); ++itr)
+        {
+            if (std::next(itr) != row.end() and std::next(itr)->first == itr->first)
+            {
+                continue;
+            }
+            neighbors.push_back(itr->first);
+            weights.push_back(itr->second);
+        }
+        offsets[index + 1] = neighbors.size();
+    }
+
+    if (std::ranges::all_of(weights, [](auto weight) { return weight == 1; }))
+    {
+        weights.clear();
+    }
+    weights.shrink_to_fit();
+
+    buildIncommingRows();
+    computeGraphDegree();
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::computeGraphDegree()
+{
+    maxDegree = 0;
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); ++index)
+    {
+        auto outDegree = offsets[index + 1] - offsets[index];
+        auto inDegree = incommingOffsets[index + 1] - incommingOffsets[index];
+        maxDegree = std::max({maxDegree, outDegree, inDegree});
+    }
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::buildIncommingRows()
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        incommingOffsets = offsets;
+        incommingNeighbors.clear();
+        return;
+    }
+
+    incommingOffsets.assign(nodeIndexMapping.size() + 1, 0);
+    for (auto destination : neighbors)
+    {
+        ++incommingOffsets[nodeIndexMapping.indexOf(destination) + 1];
+    }
+    std::partial_sum(incommingOffsets.begin(), incommingOffsets.end(), incommingOffsets.begin());
+
+    incommingNeighbors.resize(neighbors.size());
+    auto cursors = incommingOffsets;
+    for (uint32_t sourceIndex = 0; sourceIndex < nodeIndexMapping.size(); ++sourceIndex)
+    {
+        for (auto edgeIdx = offsets[sourceIndex]; edgeIdx < offsets[sourceIndex + 1]; ++edgeIdx)
+        {
+            auto& cursor = cursors[nodeIndexMapping.indexOf(neighbors[edgeIdx])];
+            incommingNeighbors[cursor++] = nodeIndexMapping.idOf(sourceIndex);
+        }
+    }
+}
+
+template <GraphDirectionality directionality>
+std::string CsrGraph<directionality>::show() const
+{
+    std::stringstream outStream;
+    outStream << std::format("Nodes amount = {}\n{{\n", nodeIndexMapping.size());
+
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); ++index)
+    {
+        outStream << std::format("{}: ", nodeIndexMapping.idOf(index));
+        for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+        {
+            auto weight = weights.empty() ? 1 : weights[edgeIdx];
+            outStream << std::format("{}[weight={}], ", neighbors[edgeIdx], weight);
+        }
+        outStream << "\n";
+    }
+    outStream << "}\n";
+    return outStream.str();
+}
+
+template <GraphDirectionality directionality>
+GraphDirectionality CsrGraph<directionality>::getDirectionality() const
+{
+    return directionality;
+}
+
+template <GraphDirectionality directionality>
+uint32_t CsrGraph<directionality>::nodesAmount() const
+{
+    return static_cast<uint32_t>(nodeIndexMapping.size());
+}
+
+template <GraphDirectionality directionality>
+uint32_t CsrGraph<directionality>::getOutgoingDegree(NodeId nodeId) const
+{
+    auto index = nodeIndexMapping.indexOf(nodeId);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return offsets[index + 1] - offsets[index];
+}
+
+template <GraphDirectionality directionality>
+uint32_t CsrGraph<directionality>::getIncommingDegree(NodeId nodeId) const
+{
+    auto index = nodeIndexMapping.indexOf(nodeId);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return incommingOffsets[index + 1] - incommingOffsets[index];
+}
+
+template <GraphDirectionality directionality>
+uint32_t CsrGraph<directionality>::degreeOf(NodeId nodeId) const
+{
+    auto index = nodeIndexMapping.indexOf(nodeId);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return 0;
+    }
+    return std::max(offsets[index + 1] - offsets[index], incommingOffsets[index + 1] - incommingOffsets[index]);
+}
+
+template <GraphDirectionality directionality>
+uint32_t CsrGraph<directionality>::graphDegree() const
+{
+    return maxDegree;
+}
+
+template <GraphDirectionality directionality>
+EdgeInfo CsrGraph<directionality>::findEdge(const EdgeInfo& edge) const
+{
+    auto sourceIndex = nodeIndexMapping.indexOf(edge.source);
+    if (sourceIndex == NodeIndexMapping::invalidIndex or not nodeIndexMapping.contains(edge.destination))
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    auto rowBegin = neighbors.begin() + offsets[sourceIndex];
+    auto rowEnd = neighbors.begin() + offsets[sourceIndex + 1];
+    auto neighbor = std::lower_bound(rowBegin, rowEnd, edge.destination);
+    if (neighbor == rowEnd or *neighbor != edge.destination)
+    {
+        return {edge.source, edge.destination, std::nullopt};
+    }
+
+    auto edgeIdx = std::distance(neighbors.begin(), neighbor);
+    return {edge.source, edge.destination, weights.empty() ? 1 : weights[edgeIdx]};
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> CsrGraph<directionality>::getNodeIds() const
+{
+    return nodeIndexMapping.ids();
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> CsrGraph<directionality>::getOutgoingNeighborsOf(NodeId node) const
+{
+    auto view = getOutgoingNeighborsView(node);
+    return {view.begin(), view.end()};
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> CsrGraph<directionality>::getIncommingNeighborsOf(NodeId node) const
+{
+    auto view = getIncommingNeighborsView(node);
+    return {view.begin(), view.end()};
+}
+
+template <GraphDirectionality directionality>
+std::vector<NodeId> CsrGraph<directionality>::getNeighborsOf(NodeId node) const
+{
+    std::vector<NodeId> result = {};
+    forEachNeighbor(node, [&result](NodeId neighbor) {
+        result.push_back(neighbor);
+    });
+    return result;
+}
+
+template <GraphDirectionality directionality>
+std::vector<EdgeInfo> CsrGraph<directionality>::getEdges() const
+{
+    std::vector<EdgeInfo> edges = {};
+    edges.reserve(neighbors.size());
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); ++index)
+    {
+        for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+        {
+            edges.push_back({.source = nodeIndexMapping.idOf(index),
+                             .destination = neighbors[edgeIdx],
+                             .weight = weights.empty() ? 1 : weights[edgeIdx]});
+        }
+    }
+    return edges;
+}
+
+template <GraphDirectionality directionality>
+std::span<const NodeId> CsrGraph<directionality>::getOutgoingNeighborsView(NodeId node) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return {};
+    }
+    return std::span(neighbors).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+template <GraphDirectionality directionality>
+std::span<const NodeId> CsrGraph<directionality>::getIncommingNeighborsView(NodeId node) const
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        return getOutgoingNeighborsView(node);
+    }
+
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return {};
+    }
+    return std::span(incommingNeighbors)
+        .subspan(incommingOffsets[index], incommingOffsets[index + 1] - incommingOffsets[index]);
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::forEachNode(NodeVisitor visitor) const
+{
+    for (auto nodeId : nodeIndexMapping.ids())
+    {
+        visitor(nodeId);
+    }
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::forEachOutgoingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    for (auto neighbor : getOutgoingNeighborsView(node))
+    {
+        visitor(neighbor);
+    }
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::forEachOutgoingEdge(NodeId node, EdgeVisitor visitor) const
+{
+    auto index = nodeIndexMapping.indexOf(node);
+    if (index == NodeIndexMapping::invalidIndex)
+    {
+        return;
+    }
+    for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+    {
+        visitor(neighbors[edgeIdx], weights.empty() ? 1 : weights[edgeIdx]);
+    }
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::forEachIncommingNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    for (auto neighbor : getIncommingNeighborsView(node))
+    {
+        visitor(neighbor);
+    }
+}
+
+template <GraphDirectionality directionality>
+void CsrGraph<directionality>::forEachNeighbor(NodeId node, NodeVisitor visitor) const
+{
+    if constexpr (directionality == GraphDirectionality::undirected)
+    {
+        forEachOutgoingNeighbor(node, visitor);
+        return;
+    }
+
+    // Both rows are sorted, so a merge visits the union in order without building it.
+    auto outgoing = getOutgoingNeighborsView(node);
+    auto incomming = getIncommingNeighborsView(node);
+    auto outItr = outgoing.begin();
+    auto inItr = incomming.begin();
+    while (outItr != outgoing.end() or inItr != incomming.end())
+    {
+        if (inItr == incomming.end() or (outItr != outgoing.end() and *outItr < *inItr))
+        {
+            visitor(*outItr++);
+        }
+        else if (outItr == outgoing.end() or *inItr < *outItr)
+        {
+            visitor(*inItr++);
+        }
+        else
+        {
+            visitor(*outItr++);
+            ++inItr;
+        }
+    }
+}
+} // namespace Graphs
@@ -0,0 +1,78 @@
+#include <Graphs/DegreeTable.hpp>
+
+namespace Graphs
+{
+template <typename Update>
+void DegreeTable::updateNode(uint32_t index, Update update)
+{
+    auto oldDegree = degreeOf(index);
+    update();
+    auto newDegree = degreeOf(index);
+
+    --nodesWithDegree[oldDegree];
+    if (newDegree >= nodesWithDegree.size())
+    {
+        nodesWithDegree.resize(newDegree + 1, 0);
+    }
+    ++nodesWithDegree[newDegree];
+
+    if (newDegree > highestDegree)
+    {
+        highestDegree = newDegree;
+    }
+    while (highestDegree > 0 and nodesWithDegree[highestDegree] == 0)
+    {
+        --highestDegree;
+    }
+}
+
+void DegreeTable::addNodes(uint32_t nodesAmount)
+{
+    incomming.resize(incomming.size() + nodesAmount, 0);
+    outgoing.resize(outgoing.size() + nodesAmount, 0);
+    if (nodesWithDegree.empty())
+    {
+        nodesWithDegree.push_back(0);
+    }
+    nodesWithDegree[0] += nodesAmount;
+}
+
+void DegreeTable::removeNode(uint32_t index)
+{
+    updateNode(index, [this, index]() {
+        incomming[index] = 0;
+        outgoing[index] = 0;
+    });
+    --nodesWithDegree[0];
+    incomming.erase(incomming.begin() + index);
+    outgoing.erase(outgoing.begin() + index);
+}
+
+void DegreeTable::edgeAdded(uint32_t sourceIndex, uint32_t destinationIndex)
+{
+    updateNode(sourceIndex, [this, sourceIndex]() {
+        ++outgoing[sourceIndex];
+    });
+    updateNode(destinationIndex, [this, destinationIndex]() {
+        ++incomming[destinationIndex];
+    });
+}
+
+void DegreeTable::edgeRemoved(uint32_t sourceIndex, uint32_t destinationIndex)
+{
+    updateNode(sourceIndex, [this, sourceIndex]() {
+        --outgoing[sourceIndex];
+    });
+    updateNode(destinationIndex, [this, destinationIndex]() {
+        --incomming[destinationIndex];
+    });
+}
+
+void DegreeTable::clear()
+{
+    incomming.clear();
+    outgoing.clear();
+    nodesWithDegree.clear();
+    highestDegree = 0;
+}
+} // namespace Graphs
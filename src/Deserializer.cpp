@@ -1,45 +1,300 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <format>
 #include <Graphs/Deserializer.hpp>
 #include <Graphs/Graph.hpp>
 #include <Graphs/SerializationFormats.hpp>
+#include <Graphs/ThreadPool.hpp>
 #include <iostream>
+#include <limits>
 #include <regex>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
 namespace
 {
+static_assert(std::endian::native == std::endian::little, "Binary snapshots are read as little-endian memory");
 
-std::vector<uint32_t> parseLstLine(const std::string& line)
+std::string_view trimCarriageReturn(std::string_view line)
 {
-    std::vector<uint32_t> neighbors = {};
-    std::stringstream stream(line);
-    std::string value = {};
+    return line.ends_with('\r') ? line.substr(0, line.size() - 1) : line;
+}
 
-    while (std::getline(stream, value, ' '))
+/*  Read-only memory mapping of a whole regular file, unmapped on destruction. The
+    pages are advised to be read sequentially, so the kernel reads ahead of the parser.
+*/
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& path)
     {
-        if (value.empty())
+        auto descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor == -1)
         {
-            continue;
+            return;
+        }
+
+        struct stat status = {};
+        isAccessible = ::fstat(descriptor, &status) == 0 and S_ISREG(status.st_mode);
+        if (isAccessible and status.st_size > 0)
+        {
+            auto size = static_cast<std::size_t>(status.st_size);
+            auto* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            isAccessible = address != MAP_FAILED;
+            if (isAccessible)
+            {
+                ::madvise(address, size, MADV_SEQUENTIAL);
+                content = {static_cast<const char*>(address), size};
+            }
+        }
+        ::close(descriptor);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    ~MappedFile()
+    {
+        if (not content.empty())
+        {
+            ::munmap(const_cast<char*>(content.data()), content.size());
+        }
+    }
+
+    bool isAccessible = false;
+    std::string_view content = {};
+};
+
+// Hands out the lines of a buffer which is already in memory, such as a mapped file.
+class BufferLines
+{
+public:
+    explicit BufferLines(std::string_view buffer) : rest(buffer) {}
+
+    // Returns false once the buffer is exhausted.
+    bool next(std::string_view& line)
+    {
+        if (rest.empty())
+        {
+            return false;
+        }
+        auto newline = rest.find('\n');
+        line = trimCarriageReturn(rest.substr(0, newline));
+        rest = newline == std::string_view::npos ? std::string_view{} : rest.substr(newline + 1);
+        return true;
+    }
+
+private:
+    std::string_view rest;
+};
+
+/*  Hands out the lines of a stream, read through a window of a fixed size instead of
+    copying the whole stream at once. A line reaching past the end of the window is
+    moved to its front before the window is refilled, and lines longer than the window
+    make it grow. Carriage returns ending the lines are dropped.
+*/
+class StreamLines
+{
+public:
+    explicit StreamLines(std::istream& stream) : stream(stream), window(windowSize) {}
+
+    // Returns false once the stream is exhausted.
+    bool next(std::string_view& line)
+    {
+        while (true)
+        {
+            auto* newline = static_cast<const char*>(std::memchr(window.data() + begin, '\n', end - begin));
+            if (newline != nullptr)
+            {
+                auto lineEnd = static_cast<std::size_t>(newline - window.data());
+                line = trimCarriageReturn({window.data() + begin, lineEnd - begin});
+                begin = lineEnd + 1;
+                return true;
+            }
+            if (isExhausted)
+            {
+                line = trimCarriageReturn({window.data() + begin, end - begin});
+                auto isLastLine = begin != end;
+                begin = end;
+                return isLastLine;
+            }
+            refill();
+        }
+    }
+
+private:
+    static constexpr std::size_t windowSize = 1 << 16;
+
+    void refill()
+    {
+        std::memmove(window.data(), window.data() + begin, end - begin);
+        end -= begin;
+        begin = 0;
+        if (end == window.size())
+        {
+            window.resize(window.size() * 2);
+        }
+        stream.read(window.data() + end, static_cast<std::streamsize>(window.size() - end));
+        end += static_cast<std::size_t>(stream.gcount());
+        isExhausted = stream.gcount() == 0;
+    }
+
+    std::istream& stream;
+    std::vector<char> window;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    bool isExhausted = false;
+};
+
+// Hands out the bytes of a buffer which is already in memory, such as a mapped file.
+class BufferBytes
+{
+public:
+    // The size of the buffer is checked against the header, so arrays are read in a single block.
+    static constexpr uint64_t blockSize = std::numeric_limits<uint64_t>::max();
+
+    explicit BufferBytes(std::string_view buffer) : rest(buffer) {}
+
+    bool holds(uint64_t size) const
+    {
+        return rest.size() >= size;
+    }
+
+    // Returns the amount of bytes copied, short of the size requested once the buffer is exhausted.
+    std::size_t read(char* destination, std::size_t size)
+    {
+        auto copied = rest.copy(destination, size);
+        rest.remove_prefix(copied);
+        return copied;
+    }
+
+private:
+    std::string_view rest;
+};
+
+/*  Hands out the bytes of a stream, whose remaining size is not known upfront. Arrays
+    are read in blocks, so a count corrupted into a huge one fails at the end of the
+    stream instead of allocating all of it at once.
+*/
+class StreamBytes
+{
+public:
+    static constexpr uint64_t blockSize = 1 << 20;
+
+    explicit StreamBytes(std::istream& stream) : stream(stream) {}
+
+    bool holds(uint64_t) const
+    {
+        return true;
+    }
+
+    // Returns the amount of bytes copied, short of the size requested once the stream is exhausted.
+    std::size_t read(char* destination, std::size_t size)
+    {
+        stream.read(destination, static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(stream.gcount());
+    }
+
+private:
+    std::istream& stream;
+};
+
+// Reads an array of a binary snapshot in blocks of the source, together with the padding which aligns the next one.
+template <typename Value, typename Bytes>
+bool readAlignedArray(Bytes& bytes, uint64_t count, std::vector<Value>& values)
+{
+    constexpr auto alignment = Graphs::BinaryFileHeader::arraysAlignment;
+
+    values.clear();
+    while (values.size() < count)
+    {
+        auto position = values.size();
+        auto blockBytes = std::min(count - position, Bytes::blockSize) * sizeof(Value);
+        values.resize(position + blockBytes / sizeof(Value));
+        if (bytes.read(reinterpret_cast<char*>(values.data() + position), blockBytes) != blockBytes)
+        {
+            return false;
         }
-        neighbors.emplace_back(std::stoul(value));
     }
-    return neighbors;
+
+    // Padding after the last array may be cut off without losing anything.
+    std::array<char, alignment> padding = {};
+    bytes.read(padding.data(), (alignment - count * sizeof(Value) % alignment) % alignment);
+    return true;
 }
 
-std::vector<Graphs::WeightType> parseMatLine(const std::string& line)
+bool isBlank(std::string_view text)
 {
-    std::vector<Graphs::WeightType> weights = {};
-    std::stringstream stream(line);
-    std::string value = {};
+    return text.find_first_not_of(" \t") == std::string_view::npos;
+}
 
-    while (std::getline(stream, value, ' '))
+/*  Calls the visitor with every number of a line of whitespace separated numbers.
+    Returns false, possibly after some calls, if anything else is found.
+*/
+template <typename Number, typename Visitor>
+bool forEachNumber(std::string_view line, Visitor visitor)
+{
+    const auto* position = line.data();
+    const auto* end = line.data() + line.size();
+    while (true)
     {
-        if (value.empty())
+        while (position != end and (*position == ' ' or *position == '\t'))
         {
-            continue;
+            ++position;
+        }
+        if (position == end)
+        {
+            return true;
         }
-        weights.emplace_back(std::stoi(value));
+
+        Number value = {};
+        auto [numberEnd, error] = std::from_chars(position, end, value);
+        if (error != std::errc{} or (numberEnd != end and *numberEnd != ' ' and *numberEnd != '\t'))
+        {
+            return false;
+        }
+        visitor(value);
+        position = numberEnd;
+    }
+}
+
+// Returns 0, which is not a valid id, unless the text holds a single positive number.
+Graphs::NodeId parseNodeId(std::string_view text)
+{
+    Graphs::NodeId nodeId = 0;
+    uint32_t numbersCount = 0;
+    auto isNumber = forEachNumber<Graphs::NodeId>(text, [&](Graphs::NodeId id) {
+        nodeId = id;
+        ++numbersCount;
+    });
+    return isNumber and numbersCount == 1 ? nodeId : 0;
+}
+
+template <typename GraphType>
+GraphType makeGraph(uint32_t nodesCount, const std::vector<Graphs::EdgeInfo>& edges)
+{
+    if constexpr (std::is_base_of_v<Graphs::Graph, GraphType>)
+    {
+        GraphType graph = {};
+        graph.addNodes(nodesCount);
+        graph.setEdges(edges);
+        return graph;
+    }
+    else
+    {
+        return GraphType{nodesCount, edges};
     }
-    return weights;
 }
 
 template <typename GraphType, Graphs::FileType Ft>
@@ -52,84 +307,266 @@ public:
     }
 };
 
-template <typename GraphType>
-class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::MAT>
+/*  Splits the buffer into parts ending at line ends, about equal in size, at most
+    as many as requested and none much smaller than a megabyte.
+*/
+std::vector<std::string_view> splitIntoLineChunks(std::string_view buffer, uint32_t maxChunksCount)
 {
-public:
-    static GraphType parse(const std::string& content)
+    constexpr std::size_t minimumChunkSize = 1 << 20;
+    auto chunksCount = std::clamp<std::size_t>(buffer.size() / minimumChunkSize, 1, std::max(maxChunksCount, 1u));
+
+    std::vector<std::string_view> chunks = {};
+    std::size_t begin = 0;
+    for (std::size_t chunk = 1; chunk < chunksCount and begin < buffer.size(); chunk++)
     {
-        if (content.empty())
+        auto newline = buffer.find('\n', std::max(begin, buffer.size() * chunk / chunksCount));
+        auto end = newline == std::string_view::npos ? buffer.size() : newline + 1;
+        chunks.push_back(buffer.substr(begin, end - begin));
+        begin = end;
+    }
+    if (begin < buffer.size())
+    {
+        chunks.push_back(buffer.substr(begin));
+    }
+    return chunks;
+}
+
+/*  Concatenates edges of the parsed chunks in their order into a single list, moving
+    sources of every chunk by its offset. Chunks are copied in parallel.
+*/
+template <typename ParsedChunk>
+std::vector<Graphs::EdgeInfo> mergeEdges(std::vector<ParsedChunk>& chunks,
+                                         const std::vector<Graphs::NodeId>& sourceOffsets,
+                                         Graphs::ThreadPool& threadPool)
+{
+    if (chunks.size() == 1 and sourceOffsets.front() == 0)
+    {
+        return std::move(chunks.front().edges);
+    }
+
+    std::vector<std::size_t> positions(chunks.size() + 1, 0);
+    for (std::size_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+        positions[chunk + 1] = positions[chunk] + chunks[chunk].edges.size();
+    }
+    std::vector<Graphs::EdgeInfo> edges(positions.back());
+    threadPool.parallelFor(static_cast<uint32_t>(chunks.size()), [&](uint32_t begin, uint32_t end) {
+        for (auto chunk = begin; chunk < end; chunk++)
         {
-            return GraphType{};
+            auto position = positions[chunk];
+            for (auto edge : chunks[chunk].edges)
+            {
+                edge.source += sourceOffsets[chunk];
+                edges[position++] = edge;
+            }
+            chunks[chunk].edges = {};
         }
+    });
+    return edges;
+}
 
-        using regItr = std::sregex_iterator;
-        std::regex matLineRegex("([0-9 ]+)[^a-zA-Z]");
-        std::vector<std::vector<Graphs::WeightType>> weights;
+// Rows of a weight matrix from a run of consecutive lines, numbered from 1 within the run.
+struct MatRows
+{
+    std::vector<Graphs::EdgeInfo> edges = {};
+    uint32_t rowsCount = 0;
+    uint32_t columnsCount = 0;
+    // Number of the first row which is not a list of numbers, if any.
+    uint32_t invalidRow = 0;
+    bool hasEvenRows = true;
+};
 
-        for (auto itr = regItr(content.begin(), content.end(), matLineRegex); itr != regItr(); ++itr)
+// Every non-blank line is a row of the weight matrix, a weight of 0 meaning no edge.
+template <typename Lines>
+MatRows parseMatRows(Lines& lines)
+{
+    MatRows rows = {};
+    std::string_view line = {};
+    while (lines.next(line))
+    {
+        if (isBlank(line))
         {
-            std::ssub_match match = (*itr)[1];
-            weights.emplace_back(parseMatLine(match.str()));
+            continue;
         }
 
-        for (const auto& line : weights)
-        {
-            if (line.size() != weights.size())
+        Graphs::NodeId nodeId = ++rows.rowsCount;
+        uint32_t column = 0;
+        auto isValidRow = forEachNumber<Graphs::WeightType>(line, [&](Graphs::WeightType weight) {
+            ++column;
+            if (weight != 0)
             {
-                std::cerr << "[Deserializer] Invalid matrix proportions.\n "
-                             "Make sure each row contains the same number of values.\n";
-                return GraphType{};
+                rows.edges.push_back({nodeId, column, weight});
             }
+        });
+        if (not isValidRow)
+        {
+            rows.invalidRow = nodeId;
+            return rows;
         }
 
-        GraphType graph = {};
-        graph.addNodes(weights.size());
-        for (uint32_t nodeId = 1; nodeId <= weights.size(); nodeId++)
+        rows.columnsCount = nodeId == 1 ? column : rows.columnsCount;
+        if (column != rows.columnsCount)
         {
-            for (uint32_t neighborId = 1; neighborId <= weights[nodeId - 1].size(); neighborId++)
-            {
-                if (weights[nodeId - 1][neighborId - 1] != 0)
-                {
-                    graph.setEdge({nodeId, neighborId, weights[nodeId - 1][neighborId - 1]});
-                }
-            }
+            rows.hasEvenRows = false;
+            return rows;
         }
-        return graph;
     }
+    return rows;
+}
+
+// Lines of an adjacency list, each holding a node id, a colon and the ids of its neighbors.
+struct LstLines
+{
+    std::vector<Graphs::EdgeInfo> edges = {};
+    Graphs::NodeId nodesCount = 0;
+    bool isValid = true;
 };
 
+template <typename Lines>
+LstLines parseLstLines(Lines& lines)
+{
+    LstLines result = {};
+    std::string_view line = {};
+    while (lines.next(line))
+    {
+        if (isBlank(line))
+        {
+            continue;
+        }
+
+        auto colon = line.find(':');
+        auto nodeId = colon != std::string_view::npos ? parseNodeId(line.substr(0, colon)) : 0;
+        auto isValidLine = nodeId != 0
+                       and forEachNumber<Graphs::NodeId>(line.substr(colon + 1), [&](Graphs::NodeId neighbor) {
+                               nodeId = neighbor != 0 ? nodeId : 0;
+                               result.edges.push_back({nodeId, neighbor});
+                               result.nodesCount = std::max(result.nodesCount, neighbor);
+                           });
+        if (not isValidLine or nodeId == 0)
+        {
+            std::cerr << std::format("[Deserializer] Invalid list line \"{}\"\n", line);
+            result.isValid = false;
+            return result;
+        }
+        result.nodesCount = std::max(result.nodesCount, nodeId);
+    }
+    return result;
+}
+
 template <typename GraphType>
-class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::LST>
+class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::MAT>
 {
 public:
-    static GraphType parse(const std::string& content)
+    template <typename Lines>
+    static GraphType parse(Lines& lines)
     {
-        if (content.empty())
+        std::vector<MatRows> chunks(1);
+        chunks.front() = parseMatRows(lines);
+        Graphs::ThreadPool callingThreadOnly(1);
+        return build(chunks, callingThreadOnly);
+    }
+
+    // Parses every chunk of lines on a thread of its own.
+    static GraphType parse(const std::vector<std::string_view>& chunks, Graphs::ThreadPool& threadPool)
+    {
+        std::vector<MatRows> parsedChunks(chunks.size());
+        threadPool.parallelFor(static_cast<uint32_t>(chunks.size()), [&](uint32_t begin, uint32_t end) {
+            for (auto chunk = begin; chunk < end; chunk++)
+            {
+                BufferLines lines(chunks[chunk]);
+                parsedChunks[chunk] = parseMatRows(lines);
+            }
+        });
+        return build(parsedChunks, threadPool);
+    }
+
+private:
+    static GraphType build(std::vector<MatRows>& chunks, Graphs::ThreadPool& threadPool)
+    {
+        std::vector<Graphs::NodeId> rowOffsets = {};
+        uint32_t rowsCount = 0;
+        uint32_t columnsCount = 0;
+        for (const auto& chunk : chunks)
         {
-            return GraphType{};
+            if (chunk.invalidRow != 0)
+            {
+                std::cerr << std::format("[Deserializer] Invalid value in matrix row {}\n",
+                                         rowsCount + chunk.invalidRow);
+                return GraphType{};
+            }
+            columnsCount = rowsCount == 0 ? chunk.columnsCount : columnsCount;
+            if (not chunk.hasEvenRows or (chunk.rowsCount != 0 and chunk.columnsCount != columnsCount))
+            {
+                return reportInvalidProportions();
+            }
+            rowOffsets.push_back(rowsCount);
+            rowsCount += chunk.rowsCount;
         }
 
-        using regItr = std::sregex_iterator;
-        std::regex nodeRegex("[0-9]:([0-9 ]+)");
-        std::vector<std::vector<Graphs::NodeId>> nodes;
-
-        for (auto itr = regItr(content.begin(), content.end(), nodeRegex); itr != regItr(); ++itr)
+        if (rowsCount != columnsCount)
         {
-            std::ssub_match match = (*itr)[1];
-            nodes.emplace_back(parseLstLine(match.str()));
+            return reportInvalidProportions();
         }
+        if (chunks.empty())
+        {
+            return GraphType{};
+        }
+        return makeGraph<GraphType>(rowsCount, mergeEdges(chunks, rowOffsets, threadPool));
+    }
 
-        GraphType graph = {};
-        graph.addNodes(nodes.size());
-        for (uint32_t nodeId = 1; nodeId <= nodes.size(); nodeId++)
+    static GraphType reportInvalidProportions()
+    {
+        std::cerr << "[Deserializer] Invalid matrix proportions.\n "
+                     "Make sure each row contains the same number of values.\n";
+        return GraphType{};
+    }
+};
+
+template <typename GraphType>
+class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::LST>
+{
+public:
+    template <typename Lines>
+    static GraphType parse(Lines& lines)
+    {
+        std::vector<LstLines> chunks(1);
+        chunks.front() = parseLstLines(lines);
+        Graphs::ThreadPool callingThreadOnly(1);
+        return build(chunks, callingThreadOnly);
+    }
+
+    // Parses every chunk of lines on a thread of its own.
+    static GraphType parse(const std::vector<std::string_view>& chunks, Graphs::ThreadPool& threadPool)
+    {
+        std::vector<LstLines> parsedChunks(chunks.size());
+        threadPool.parallelFor(static_cast<uint32_t>(chunks.size()), [&](uint32_t begin, uint32_t end) {
+            for (auto chunk = begin; chunk < end; chunk++)
+            {
+                BufferLines lines(chunks[chunk]);
+                parsedChunks[chunk] = parseLstLines(lines);
+            }
+        });
+        return build(parsedChunks, threadPool);
+    }
+
+private:
+    static GraphType build(std::vector<LstLines>& chunks, Graphs::ThreadPool& threadPool)
+    {
+        Graphs::NodeId nodesCount = 0;
+        for (const auto& chunk : chunks)
         {
-            for (auto neighbor : nodes[nodeId - 1])
+            if (not chunk.isValid)
             {
-                graph.setEdge({nodeId, neighbor});
+                return GraphType{};
             }
+            nodesCount = std::max(nodesCount, chunk.nodesCount);
         }
-        return graph;
+        if (chunks.empty())
+        {
+            return GraphType{};
+        }
+        return makeGraph<GraphType>(nodesCount,
+                                    mergeEdges(chunks, std::vector<Graphs::NodeId>(chunks.size(), 0), threadPool));
     }
 };
 
@@ -137,26 +574,28 @@ template <typename GraphType>
 class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::GRAPHML>
 {
 public:
-    static GraphType parse(const std::string& content)
+    static GraphType parse(std::string_view content)
     {
         if (content.empty())
         {
             return GraphType{};
         }
 
-        using regItr = std::sregex_iterator;
+        using regItr = std::cregex_iterator;
         std::regex directionalityRegex("edgedefault=\"([a-z]+)\"");
         std::regex nodeRegex("<node id=\"n([0-9]+)\"/>");
-        std::regex edgeRegex("<edge source=\"n([0-9]+)\" target=\"n([0-9]+)\"/>");
+        std::regex edgeRegex("<edge source=\"n([0-9]+)\" target=\"n([0-9]+)\""
+                             "(?:/>|><data key=\"weight\">(-?[0-9]+)</data></edge>)");
+        std::regex defaultWeightRegex("<key id=\"weight\"[^>]*><default>(-?[0-9]+)</default>");
         std::vector<Graphs::EdgeInfo> nodes;
         Graphs::NodeId nodesCount = 0;
 
         bool incrementIds = false;
 
-        auto directionalityItr = regItr(content.begin(), content.end(), directionalityRegex);
+        auto directionalityItr = regItr(content.data(), content.data() + content.size(), directionalityRegex);
         if (directionalityItr != regItr())
         {
-            std::ssub_match match = (*directionalityItr)[1];
+            std::csub_match match = (*directionalityItr)[1];
             auto directionalityMissmatch
                 = ((match.str() == "undirected" and GraphType::Directionality == Graphs::GraphDirectionality::directed)
                    or (match.str() == "directed"
@@ -168,9 +607,17 @@ public:
             }
         }
 
-        for (auto itr = regItr(content.begin(), content.end(), nodeRegex); itr != regItr(); ++itr)
+        // Edges without data take the default of the weight key, or weight 1 when the file declares none.
+        std::optional<Graphs::WeightType> defaultWeight = {};
+        std::cmatch defaultWeightMatch;
+        if (std::regex_search(content.data(), content.data() + content.size(), defaultWeightMatch, defaultWeightRegex))
         {
-            std::ssub_match match = (*itr)[1];
+            defaultWeight = std::stoi(defaultWeightMatch[1].str());
+        }
+
+        for (auto itr = regItr(content.data(), content.data() + content.size(), nodeRegex); itr != regItr(); ++itr)
+        {
+            std::csub_match match = (*itr)[1];
             Graphs::NodeId id = std::stoul(match.str());
 
             if (id == 0)
@@ -180,30 +627,196 @@ public:
             nodesCount = std::max(nodesCount, incrementIds ? id + 1 : id);
         }
 
-        for (auto itr = regItr(content.begin(), content.end(), edgeRegex); itr != regItr(); ++itr)
+        for (auto itr = regItr(content.data(), content.data() + content.size(), edgeRegex); itr != regItr(); ++itr)
         {
             if (itr->size() < 3)
             {
                 std::cerr << "[Deserializer] Invalid line format";
                 continue;
             }
-            std::ssub_match sourceNode = (*itr)[1];
-            std::ssub_match destinationNode = (*itr)[2];
+            std::csub_match sourceNode = (*itr)[1];
+            std::csub_match destinationNode = (*itr)[2];
 
             Graphs::NodeId srcNodeId = std::stoul(sourceNode.str());
             Graphs::NodeId destNodeId = std::stoul(destinationNode.str());
 
+            auto weight = defaultWeight;
+            if ((*itr)[3].matched)
+            {
+                weight = std::stoi((*itr)[3].str());
+            }
+
             // clang-format off
             nodes.push_back({.source = incrementIds ? srcNodeId + 1 : srcNodeId, 
-                             .destination = incrementIds ? destNodeId + 1 : destNodeId});
+                             .destination = incrementIds ? destNodeId + 1 : destNodeId,
+                             .weight = weight});
             // clang-format on
         }
 
-        GraphType graph = {};
-        graph.addNodes(nodesCount);
-        graph.setEdges(nodes);
+        return makeGraph<GraphType>(nodesCount, nodes);
+    }
+};
 
-        return graph;
+template <typename GraphType>
+class ContentIntoGraphRepresentationParser<GraphType, Graphs::FileType::BINARY>
+{
+public:
+    template <typename Bytes>
+    static GraphType parse(Bytes& bytes)
+    {
+        using Header = Graphs::BinaryFileHeader;
+        Header header = {};
+        if (bytes.read(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header))
+        {
+            std::cerr << "[Deserializer] Binary snapshot is truncated\n";
+            return GraphType{};
+        }
+        if (header.magic != Header::expectedMagic)
+        {
+            std::cerr << "[Deserializer] Not a binary snapshot\n";
+            return GraphType{};
+        }
+        if (header.version != Header::currentVersion)
+        {
+            std::cerr << std::format("[Deserializer] Unsupported binary snapshot version {}\n", header.version);
+            return GraphType{};
+        }
+        auto isDirected = GraphType::Directionality == Graphs::GraphDirectionality::directed;
+        if (header.directionality != (isDirected ? 1 : 0))
+        {
+            std::cerr << "[Deserializer] Graph directionality mismatch\n";
+            return GraphType{};
+        }
+        if (header.nodesCount >= std::numeric_limits<uint32_t>::max()
+            or header.edgesCount > std::numeric_limits<uint32_t>::max())
+        {
+            std::cerr << "[Deserializer] Binary snapshot is too large\n";
+            return GraphType{};
+        }
+        if (not bytes.holds(arraysSize(header)))
+        {
+            std::cerr << "[Deserializer] Binary snapshot is truncated\n";
+            return GraphType{};
+        }
+
+        std::vector<uint32_t> offsets = {};
+        std::vector<Graphs::NodeId> neighbors = {};
+        std::vector<Graphs::WeightType> weights = {};
+        if (not readAlignedArray(bytes, header.nodesCount + 1, offsets)
+            or not readAlignedArray(bytes, header.edgesCount, neighbors)
+            or (header.isWeighted and not readAlignedArray(bytes, header.edgesCount, weights)))
+        {
+            std::cerr << "[Deserializer] Binary snapshot is truncated\n";
+            return GraphType{};
+        }
+        if (not hasValidRows(offsets, neighbors)
+            or (not isDirected and not hasSymmetricRows(offsets, neighbors, weights)))
+        {
+            std::cerr << "[Deserializer] Corrupted binary snapshot\n";
+            return GraphType{};
+        }
+
+        if constexpr (std::is_same_v<GraphType, Graphs::CsrGraph<GraphType::Directionality>>)
+        {
+            return GraphType{std::move(offsets), std::move(neighbors), std::move(weights)};
+        }
+        else
+        {
+            return makeGraph<GraphType>(static_cast<uint32_t>(header.nodesCount), toEdges(offsets, neighbors, weights));
+        }
+    }
+
+private:
+    // Padding after the last array is optional, as it is when reading it.
+    static uint64_t arraysSize(const Graphs::BinaryFileHeader& header)
+    {
+        auto aligned = [](uint64_t size) {
+            constexpr auto alignment = Graphs::BinaryFileHeader::arraysAlignment;
+            return (size + alignment - 1) / alignment * alignment;
+        };
+        auto rowsSize = header.edgesCount * sizeof(Graphs::NodeId);
+        auto offsetsSize = aligned((header.nodesCount + 1) * sizeof(uint32_t));
+        return header.isWeighted ? offsetsSize + aligned(rowsSize) + header.edgesCount * sizeof(Graphs::WeightType)
+                                 : offsetsSize + rowsSize;
+    }
+
+    // Rows have to lie within the neighbors and hold existing nodes in ascending order, as CsrGraph relies on.
+    static bool hasValidRows(const std::vector<uint32_t>& offsets, const std::vector<Graphs::NodeId>& neighbors)
+    {
+        auto nodesCount = offsets.size() - 1;
+        if (offsets.front() != 0 or offsets.back() != neighbors.size())
+        {
+            return false;
+        }
+        for (std::size_t index = 0; index < nodesCount; ++index)
+        {
+            if (offsets[index] > offsets[index + 1])
+            {
+                return false;
+            }
+            Graphs::NodeId previous = 0;
+            for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+            {
+                if (neighbors[edgeIdx] <= previous or neighbors[edgeIdx] > nodesCount)
+                {
+                    return false;
+                }
+                previous = neighbors[edgeIdx];
+            }
+        }
+        return true;
+    }
+
+    // Undirected rows have to list every edge from both of its ends with the same weight. Rows are sorted by now.
+    static bool hasSymmetricRows(const std::vector<uint32_t>& offsets,
+                                 const std::vector<Graphs::NodeId>& neighbors,
+                                 const std::vector<Graphs::WeightType>& weights)
+    {
+        for (uint32_t index = 0; index + 1 < offsets.size(); ++index)
+        {
+            Graphs::NodeId source = index + 1;
+            for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+            {
+                auto destination = neighbors[edgeIdx];
+                auto rowBegin = neighbors.begin() + offsets[destination - 1];
+                auto rowEnd = neighbors.begin() + offsets[destination];
+                auto reverse = std::lower_bound(rowBegin, rowEnd, source);
+                if (reverse == rowEnd or *reverse != source
+                    or (not weights.empty() and weights[reverse - neighbors.begin()] != weights[edgeIdx]))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Undirected edges are taken from the row of their lower end only, setting an edge sets both of its directions.
+    static std::vector<Graphs::EdgeInfo> toEdges(const std::vector<uint32_t>& offsets,
+                                                 const std::vector<Graphs::NodeId>& neighbors,
+                                                 const std::vector<Graphs::WeightType>& weights)
+    {
+        std::vector<Graphs::EdgeInfo> edges = {};
+        edges.reserve(neighbors.size());
+        for (uint32_t index = 0; index + 1 < offsets.size(); ++index)
+        {
+            Graphs::NodeId source = index + 1;
+            for (auto edgeIdx = offsets[index]; edgeIdx < offsets[index + 1]; ++edgeIdx)
+            {
+                auto destination = neighbors[edgeIdx];
+                if (GraphType::Directionality == Graphs::GraphDirectionality::undirected and destination < source)
+                {
+                    continue;
+                }
+                std::optional<Graphs::WeightType> weight = {};
+                if (not weights.empty())
+                {
+                    weight = weights[edgeIdx];
+                }
+                edges.push_back({source, destination, weight});
+            }
+        }
+        return edges;
     }
 };
 
@@ -223,7 +836,8 @@ GraphType Deserializer<GraphType, Guard>::deserializeLstFile(std::istream& file)
         std::cerr << "[Deserializer] Error accessing file";
         return GraphType{};
     }
-    return ContentIntoGraphRepresentationParser<GraphType, FileType::LST>::parse(readStreamContent(file));
+    StreamLines lines(file);
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::LST>::parse(lines);
 }
 
 template <typename GraphType, typename Guard>
@@ -234,7 +848,8 @@ GraphType Deserializer<GraphType, Guard>::deserializeMatFile(std::istream& file)
         std::cerr << "[Deserializer] Error accessing file";
         return GraphType{};
     }
-    return ContentIntoGraphRepresentationParser<GraphType, FileType::MAT>::parse(readStreamContent(file));
+    StreamLines lines(file);
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::MAT>::parse(lines);
 }
 
 template <typename GraphType, typename Guard>
@@ -247,4 +862,69 @@ GraphType Deserializer<GraphType, Guard>::deserializeGraphMlFile(std::istream& f
     }
     return ContentIntoGraphRepresentationParser<GraphType, FileType::GRAPHML>::parse(readStreamContent(file));
 }
+
+template <typename GraphType, typename Guard>
+GraphType Deserializer<GraphType, Guard>::loadLstFile(const std::filesystem::path& path, uint32_t threadsCount)
+{
+    MappedFile file(path);
+    if (not file.isAccessible)
+    {
+        std::cerr << std::format("[Deserializer] Error accessing file {}\n", path.string());
+        return GraphType{};
+    }
+    auto chunks = splitIntoLineChunks(file.content, threadsCount);
+    ThreadPool threadPool(static_cast<uint32_t>(std::max<std::size_t>(chunks.size(), 1)));
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::LST>::parse(chunks, threadPool);
+}
+
+template <typename GraphType, typename Guard>
+GraphType Deserializer<GraphType, Guard>::loadMatFile(const std::filesystem::path& path, uint32_t threadsCount)
+{
+    MappedFile file(path);
+    if (not file.isAccessible)
+    {
+        std::cerr << std::format("[Deserializer] Error accessing file {}\n", path.string());
+        return GraphType{};
+    }
+    auto chunks = splitIntoLineChunks(file.content, threadsCount);
+    ThreadPool threadPool(static_cast<uint32_t>(std::max<std::size_t>(chunks.size(), 1)));
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::MAT>::parse(chunks, threadPool);
+}
+
+template <typename GraphType, typename Guard>
+GraphType Deserializer<GraphType, Guard>::loadGraphMlFile(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    if (not file.isAccessible)
+    {
+        std::cerr << std::format("[Deserializer] Error accessing file {}\n", path.string());
+        return GraphType{};
+    }
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::GRAPHML>::parse(file.content);
+}
+
+template <typename GraphType, typename Guard>
+GraphType Deserializer<GraphType, Guard>::deserializeBinaryFile(std::istream& file)
+{
+    if (not file.good())
+    {
+        std::cerr << "[Deserializer] Error accessing file";
+        return GraphType{};
+    }
+    StreamBytes bytes(file);
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::BINARY>::parse(bytes);
+}
+
+template <typename GraphType, typename Guard>
+GraphType Deserializer<GraphType, Guard>::loadBinaryFile(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    if (not file.isAccessible)
+    {
+        std::cerr << std::format("[Deserializer] Error accessing file {}\n", path.string());
+        return GraphType{};
+    }
+    BufferBytes bytes(file.content);
+    return ContentIntoGraphRepresentationParser<GraphType, FileType::BINARY>::parse(bytes);
+}
 } // namespace Graphs
@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <Graphs/IncrementalColoring.hpp>
+#include <memory>
+
+namespace Graphs::Algorithm
+{
+IncrementalColoring::IncrementalColoring(Graph& graph, uint32_t reoptimizationPeriod)
+    : graph{graph}, reoptimizationPeriod{reoptimizationPeriod}
+{
+    graph.forEachNode([this](NodeId node) {
+        highestId = std::max(highestId, node);
+    });
+    colors.assign(highestId + 1, uncolored);
+    reoptimize();
+}
+
+void IncrementalColoring::setEdge(const EdgeInfo& edge)
+{
+    graph.setEdge(edge);
+    resolveConflict(edge.source, edge.destination);
+    mutationApplied();
+}
+
+void IncrementalColoring::addNodes(uint32_t nodesAmount)
+{
+    graph.addNodes(nodesAmount);
+    colors.resize(std::max<std::size_t>(colors.size(), highestId + nodesAmount + 1), uncolored);
+    for (uint32_t i = 0; i < nodesAmount; i++)
+    {
+        assign(++highestId, 0);
+    }
+    mutationApplied();
+}
+
+void IncrementalColoring::removeNode(NodeId node)
+{
+    if (colorOf(node) == uncolored)
+    {
+        return;
+    }
+
+    std::vector<NodeId> neighbors = {};
+    graph.forEachNeighbor(node, [&neighbors](NodeId neighbor) {
+        neighbors.push_back(neighbor);
+    });
+    graph.removeNode(node);
+    assign(node, uncolored);
+
+    // New nodes get the id following the highest one, so it has to follow removals the way the graph does.
+    while (highestId > 0 and colors[highestId] == uncolored)
+    {
+        --highestId;
+    }
+    for (auto neighbor : neighbors)
+    {
+        lowerColor(neighbor);
+    }
+    mutationApplied();
+}
+
+void IncrementalColoring::removeEdge(const EdgeInfo& edge)
+{
+    graph.removeEdge(edge);
+    lowerColor(edge.source);
+    lowerColor(edge.destination);
+    mutationApplied();
+}
+
+void IncrementalColoring::reset()
+{
+    graph.reset();
+    highestId = 0;
+    colors.assign(1, uncolored);
+    nodesWithColor.clear();
+    usedColorsCount = 0;
+    mutationsSinceReoptimization = 0;
+}
+
+void IncrementalColoring::reoptimize()
+{
+    mutationsSinceReoptimization = 0;
+    if (graph.nodesAmount() == 0)
+    {
+        return;
+    }
+
+    auto result = std::make_shared<ColoringResult>();
+    DSaturColoring<notVerbose>{result}(graph);
+    auto& [maxColor, coloring] = *result;
+    if (not nodesWithColor.empty() and maxColor + 1 >= colorsCount())
+    {
+        return;
+    }
+    for (auto [node, color] : coloring)
+    {
+        assign(node, color);
+    }
+}
+
+ColoringVector IncrementalColoring::getColoring() const
+{
+    ColoringVector coloring = {};
+    coloring.reserve(graph.nodesAmount());
+    for (NodeId node = 1; node <= highestId; node++)
+    {
+        if (colors[node] != uncolored)
+        {
+            coloring.emplace_back(node, colors[node]);
+        }
+    }
+    return coloring;
+}
+
+void IncrementalColoring::assign(NodeId node, ColorId color)
+{
+    auto& nodeColor = colors[node];
+    if (nodeColor == color)
+    {
+        return;
+    }
+    if (nodeColor != uncolored)
+    {
+        if (--nodesWithColor[nodeColor] == 0)
+        {
+            --usedColorsCount;
+        }
+        ++recolorings;
+    }
+    if (color != uncolored)
+    {
+        if (color >= nodesWithColor.size())
+        {
+            nodesWithColor.resize(color + 1, 0);
+        }
+        if (nodesWithColor[color]++ == 0)
+        {
+            ++usedColorsCount;
+        }
+    }
+    nodeColor = color;
+
+    while (not nodesWithColor.empty() and nodesWithColor.back() == 0)
+    {
+        nodesWithColor.pop_back();
+    }
+}
+
+ColorId IncrementalColoring::firstFreeColor(NodeId node)
+{
+    // A free color is always found below the highest one in use or right above it.
+    forbiddenStamps.resize(std::max<std::size_t>(forbiddenStamps.size(), colorsSpan() + 1), 0);
+    ++stamp;
+    graph.forEachNeighbor(node, [this, node](NodeId neighbor) {
+        if (neighbor != node)
+        {
+            forbiddenStamps[colors[neighbor]] = stamp;
+        }
+    });
+
+    ColorId color = 0;
+    while (forbiddenStamps[color] == stamp)
+    {
+        ++color;
+    }
+    return color;
+}
+
+void IncrementalColoring::resolveConflict(NodeId source, NodeId destination)
+{
+    if (source == destination or colorOf(source) == uncolored or colorOf(source) != colorOf(destination))
+    {
+        return;
+    }
+    // The endpoint of the smaller degree is the cheaper one to recolor, and has the fewer colors excluded.
+    auto recolored = graph.degreeOf(source) <= graph.degreeOf(destination) ? source : destination;
+    assign(recolored, firstFreeColor(recolored));
+}
+
+void IncrementalColoring::lowerColor(NodeId node)
+{
+    if (colorOf(node) == uncolored or colors[node] == 0)
+    {
+        return;
+    }
+    if (auto color = firstFreeColor(node); color < colors[node])
+    {
+        assign(node, color);
+    }
+}
+
+void IncrementalColoring::mutationApplied()
+{
+    if (reoptimizationPeriod != 0 and ++mutationsSinceReoptimization >= reoptimizationPeriod)
+    {
+        reoptimize();
+    }
+}
+} // namespace Graphs::Algorithm
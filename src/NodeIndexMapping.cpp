@@ -0,0 +1,72 @@
+#include <Graphs/NodeIndexMapping.hpp>
+
+namespace Graphs
+{
+NodeIndexMapping::NodeIndexMapping(std::vector<NodeId> sortedIds) : indexToId(std::move(sortedIds))
+{
+    refreshLookupTable(0);
+}
+
+void NodeIndexMapping::addNodes(uint32_t nodesAmount)
+{
+    auto firstNewIndex = size();
+    auto highest = highestId();
+    for (uint32_t i = 0; i < nodesAmount; i++)
+    {
+        indexToId.push_back(highest + i + 1);
+    }
+    refreshLookupTable(firstNewIndex);
+}
+
+uint32_t NodeIndexMapping::removeNode(NodeId nodeId)
+{
+    auto index = indexOf(nodeId);
+    if (index == invalidIndex)
+    {
+        return invalidIndex;
+    }
+
+    indexToId.erase(indexToId.begin() + index);
+    if (nodeId < idToIndex.size())
+    {
+        idToIndex[nodeId] = invalidIndex;
+    }
+    refreshLookupTable(index);
+    return index;
+}
+
+void NodeIndexMapping::clear()
+{
+    indexToId.clear();
+    idToIndex.clear();
+    contiguous = true;
+}
+
+void NodeIndexMapping::refreshLookupTable(uint32_t firstChangedIndex)
+{
+    // Ids are unique and ascending, so they are exactly 1..size when they start at 1 and end at size.
+    bool wasContiguous = contiguous;
+    contiguous = indexToId.empty() or (indexToId.front() == 1 and indexToId.back() == indexToId.size());
+    if (contiguous)
+    {
+        idToIndex.clear();
+        idToIndex.shrink_to_fit();
+        return;
+    }
+
+    if (wasContiguous)
+    {
+        idToIndex.assign(highestId() + 1, invalidIndex);
+        firstChangedIndex = 0;
+    }
+    else if (idToIndex.size() <= highestId())
+    {
+        idToIndex.resize(highestId() + 1, invalidIndex);
+    }
+
+    for (auto index = firstChangedIndex; index < indexToId.size(); ++index)
+    {
+        idToIndex[indexToId[index]] = index;
+    }
+}
+} // namespace Graphs
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <Graphs/Orderings.hpp>
+#include <random>
+#include <ranges>
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+// Stable counting sort of the nodes by non-increasing key; keys[i] belongs to nodes[i].
+Permutation sortByKeyDescending(const Permutation& nodes, const std::vector<uint32_t>& keys)
+{
+    auto maxKey = keys.empty() ? 0u : std::ranges::max(keys);
+    std::vector<uint32_t> bucketStarts(maxKey + 2, 0);
+    for (auto key : keys)
+    {
+        ++bucketStarts[maxKey - key + 1];
+    }
+    for (std::size_t bucket = 1; bucket < bucketStarts.size(); bucket++)
+    {
+        bucketStarts[bucket] += bucketStarts[bucket - 1];
+    }
+
+    Permutation sorted(nodes.size());
+    for (std::size_t position = 0; position < nodes.size(); position++)
+    {
+        sorted[bucketStarts[maxKey - keys[position]]++] = nodes[position];
+    }
+    return sorted;
+}
+
+std::vector<uint32_t> collectKeys(const Permutation& nodes, auto keyOf)
+{
+    std::vector<uint32_t> keys = {};
+    keys.reserve(nodes.size());
+    for (auto node : nodes)
+    {
+        keys.push_back(keyOf(node));
+    }
+    return keys;
+}
+} // namespace
+
+Permutation largestFirstOrdering(const GraphReader& graph, TieBreak tieBreak, uint64_t seed)
+{
+    Permutation nodes = graph.getNodeIds();
+
+    // Counting sort is stable, so ties keep the order the nodes are in before the degree pass.
+    switch (tieBreak)
+    {
+        case TieBreak::byId:
+            break;
+        case TieBreak::random:
+            std::ranges::shuffle(nodes, std::mt19937_64{seed});
+            break;
+        case TieBreak::incommingDegree:
+            nodes = sortByKeyDescending(nodes, collectKeys(nodes, [&graph](NodeId node) {
+                                            return graph.getIncommingDegree(node);
+                                        }));
+            break;
+    }
+
+    return sortByKeyDescending(nodes, collectKeys(nodes, [&graph](NodeId node) {
+                                   return graph.degreeOf(node);
+                               }));
+}
+
+DegeneracyResult smallestLastOrdering(const GraphReader& graph)
+{
+    auto [ordering, degeneracy, coreNumbers] = DegeneracyResult{};
+    NodeIndexMapping mapping(graph.getNodeIds());
+    auto nodesCount = mapping.size();
+    if (nodesCount == 0)
+    {
+        return {std::move(ordering), degeneracy, std::move(coreNumbers)};
+    }
+
+    auto forEachNeighborIndex = [&graph, &mapping](uint32_t index, auto visitor) {
+        graph.forEachNeighbor(mapping.idOf(index), [&mapping, &visitor, index](NodeId neighbor) {
+            if (auto neighborIndex = mapping.indexOf(neighbor); neighborIndex != index)
+            {
+                visitor(neighborIndex);
+            }
+        });
+    };
+
+    std::vector<uint32_t> degrees(nodesCount, 0);
+    for (uint32_t index = 0; index < nodesCount; index++)
+    {
+        forEachNeighborIndex(index, [&degrees, index](uint32_t) {
+            ++degrees[index];
+        });
+    }
+
+    // Bucket queue laid out in a single array: nodes sorted by current degree, with the start of every
+    // degree bucket kept aside. Lowering a degree swaps the node to the front of its bucket and moves
+    // the bucket boundary past it, so every update is O(1).
+    auto maxDegree = std::ranges::max(degrees);
+    std::vector<uint32_t> bucketStarts(maxDegree + 2, 0);
+    for (auto degree : degrees)
+    {
+        ++bucketStarts[degree + 1];
+    }
+    for (uint32_t degree = 1; degree < bucketStarts.size(); degree++)
+    {
+        bucketStarts[degree] += bucketStarts[degree - 1];
+    }
+
+    std::vector<uint32_t> queue(nodesCount);
+    std::vector<uint32_t> positions(nodesCount);
+    {
+        auto nextFree = bucketStarts;
+        for (uint32_t index = 0; index < nodesCount; index++)
+        {
+            positions[index] = nextFree[degrees[index]]++;
+            queue[positions[index]] = index;
+        }
+    }
+
+    // The queue front is always a node of minimal remaining degree. Removing it lowers each neighbor
+    // by one, so the bucket right below it is the only one that may fill up again; its start is reset
+    // to the new front before any neighbor moves into it. Core numbers are the running maximum of the
+    // degrees at removal.
+    std::vector<uint32_t> cores(nodesCount, 0);
+    for (uint32_t position = 0, coreNumber = 0; position < nodesCount; position++)
+    {
+        auto index = queue[position];
+        auto degree = degrees[index];
+        bucketStarts[degree] = position + 1;
+        if (degree > 0)
+        {
+            bucketStarts[degree - 1] = position + 1;
+        }
+        coreNumber = std::max(coreNumber, degree);
+        cores[index] = coreNumber;
+
+        forEachNeighborIndex(index, [&](uint32_t neighborIndex) {
+            if (positions[neighborIndex] <= position)
+            {
+                return;
+            }
+
+            auto neighborDegree = degrees[neighborIndex];
+            auto bucketFront = bucketStarts[neighborDegree];
+            auto frontIndex = queue[bucketFront];
+            std::swap(queue[bucketFront], queue[positions[neighborIndex]]);
+            std::swap(positions[frontIndex], positions[neighborIndex]);
+            ++bucketStarts[neighborDegree];
+            --degrees[neighborIndex];
+        });
+    }
+
+    ordering.reserve(nodesCount);
+    for (auto index : queue | std::views::reverse)
+    {
+        ordering.push_back(mapping.idOf(index));
+    }
+
+    coreNumbers.reserve(nodesCount);
+    for (uint32_t index = 0; index < nodesCount; index++)
+    {
+        coreNumbers.emplace_back(mapping.idOf(index), cores[index]);
+        degeneracy = std::max(degeneracy, cores[index]);
+    }
+
+    return {std::move(ordering), degeneracy, std::move(coreNumbers)};
+}
+} // namespace Graphs::Algorithm
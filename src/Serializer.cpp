@@ -1,24 +1,85 @@
 #include <algorithm>
+#include <bit>
+#include <charconv>
+#include <concepts>
 #include <Graphs/Graph.hpp>
+#include <Graphs/NodeIndexMapping.hpp>
 #include <Graphs/SerializationFormats.hpp>
 #include <Graphs/Serializer.hpp>
+#include <limits>
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 namespace
 {
-std::string makeGraphMlHeader()
-{
-    return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-           "  <graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\"\n"
-           "    xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
-           "    xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns\n"
-           "    http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">\n";
-}
+static_assert(std::endian::native == std::endian::little, "Binary snapshots are written as little-endian memory");
+
+constexpr std::string_view graphMlHeader
+    = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "  <graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\"\n"
+      "    xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
+      "    xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns\n"
+      "    http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">\n"
+      "  <key id=\"weight\" for=\"edge\" attr.name=\"weight\" attr.type=\"int\"><default>1</default></key>\n";
+
+constexpr std::string_view graphMlClosing = "  </graph>\n</graphml>";
 
-std::string makeGraphMlClosing()
+/*  Collects the output in a buffer of a fixed size, handed over to the stream whenever
+    it fills up, so a document is written without ever being held in memory whole.
+*/
+class BufferedWriter
 {
-    return "  </graph>\n</graphml>";
-}
+public:
+    explicit BufferedWriter(std::ostream& out) : out(out), buffer(bufferSize) {}
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter(BufferedWriter&&) = delete;
+
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(BufferedWriter&&) = delete;
+
+    void write(std::string_view text)
+    {
+        if (text.size() > buffer.size() - used)
+        {
+            flush();
+        }
+        if (text.size() > buffer.size())
+        {
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+            return;
+        }
+        std::ranges::copy(text, buffer.begin() + used);
+        used += text.size();
+    }
+
+    template <std::integral Number>
+    void write(Number number)
+    {
+        // Room for all the digits and the sign.
+        constexpr std::size_t maxLength = std::numeric_limits<Number>::digits10 + 2;
+        if (buffer.size() - used < maxLength)
+        {
+            flush();
+        }
+        auto [end, error] = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), number);
+        used = static_cast<std::size_t>(end - buffer.data());
+    }
+
+    void flush()
+    {
+        out.write(buffer.data(), static_cast<std::streamsize>(used));
+        used = 0;
+    }
+
+private:
+    static constexpr std::size_t bufferSize = 1 << 20;
+
+    std::ostream& out;
+    std::vector<char> buffer;
+    std::size_t used = 0;
+};
 
 std::string processGraphIntoLstRepresentation(const Graphs::Graph& graph)
 {
@@ -67,26 +128,93 @@ std::string processGraphIntoMatRepresentation(const Graphs::Graph& graph)
     return out.str();
 }
 
-std::string processGraphIntoGraphMlRepresentation(const Graphs::Graph& graph)
+// Nodes are written as n0, n1, ... for ids 1, 2, ...; weights other than the default 1 are written as edge data.
+void writeGraphMlRepresentation(std::ostream& out, const Graphs::Graph& graph)
 {
-    std::stringstream out = {};
-    out << makeGraphMlHeader();
-    auto directionality
-        = graph.getDirectionality() == Graphs::GraphDirectionality::directed ? "directed" : "undirected";
-    out << std::format("  <graph id=\"Graph\" edgedefault=\"{}\">\n", directionality);
-    for (auto& node : graph.getNodeIds())
-    {
-        out << std::format("    <node id=\"n{}\"/>\n", node - 1);
-    }
-    for (auto& node : graph.getNodeIds())
+    BufferedWriter writer(out);
+    writer.write(graphMlHeader);
+    auto isDirected = graph.getDirectionality() == Graphs::GraphDirectionality::directed;
+    writer.write(isDirected ? "  <graph id=\"Graph\" edgedefault=\"directed\">\n"
+                            : "  <graph id=\"Graph\" edgedefault=\"undirected\">\n");
+    graph.forEachNode([&writer](Graphs::NodeId node) {
+        writer.write("    <node id=\"n");
+        writer.write(node - 1);
+        writer.write("\"/>\n");
+    });
+    graph.forEachNode([&writer, &graph](Graphs::NodeId node) {
+        graph.forEachOutgoingEdge(node, [&writer, node](Graphs::NodeId neighbor, Graphs::WeightType weight) {
+            writer.write("    <edge source=\"n");
+            writer.write(node - 1);
+            writer.write("\" target=\"n");
+            writer.write(neighbor - 1);
+            if (weight == 1)
+            {
+                writer.write("\"/>\n");
+                return;
+            }
+            writer.write("\"><data key=\"weight\">");
+            writer.write(weight);
+            writer.write("</data></edge>\n");
+        });
+    });
+    writer.write(graphMlClosing);
+    writer.flush();
+}
+
+// Writes the bytes of the array, padded with zeros up to the alignment of the next one.
+template <typename Value>
+void writeAlignedArray(std::ostream& out, const std::vector<Value>& values)
+{
+    constexpr auto alignment = Graphs::BinaryFileHeader::arraysAlignment;
+    constexpr std::array<char, alignment> padding = {};
+    auto size = values.size() * sizeof(Value);
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size));
+    out.write(padding.data(), static_cast<std::streamsize>((alignment - size % alignment) % alignment));
+}
+
+void writeBinaryRepresentation(std::ostream& out, const Graphs::GraphReader& graph)
+{
+    Graphs::NodeIndexMapping mapping(graph.getNodeIds());
+    std::vector<uint32_t> offsets(mapping.size() + 1, 0);
+    std::vector<Graphs::NodeId> neighbors = {};
+    std::vector<Graphs::WeightType> weights = {};
+
+    // Node ids are renumbered densely, and each row is sorted, so the snapshot loads without a pass over the edges.
+    using Arc = std::pair<Graphs::NodeId, Graphs::WeightType>;
+    std::vector<Arc> row = {};
+    for (uint32_t index = 0; index < mapping.size(); ++index)
     {
-        for (auto& neighbor : graph.getOutgoingNeighborsOf(node))
+        row.clear();
+        graph.forEachOutgoingEdge(mapping.idOf(index), [&](Graphs::NodeId neighbor, Graphs::WeightType weight) {
+            row.emplace_back(mapping.indexOf(neighbor) + 1, weight);
+        });
+        std::ranges::sort(row, std::less<>(), &Arc::first);
+        // Offsets are 32-bit, so a snapshot holds at most 2^32 - 1 neighbor ids.
+        if (row.size() > std::numeric_limits<uint32_t>::max() - neighbors.size())
         {
-            out << std::format("    <edge source=\"n{}\" target=\"n{}\"/>\n", node - 1, neighbor - 1);
+            throw std::runtime_error("[Serializer] Graph has too many edges for a binary snapshot");
         }
+        for (auto [neighbor, weight] : row)
+        {
+            neighbors.push_back(neighbor);
+            weights.push_back(weight);
+        }
+        offsets[index + 1] = static_cast<uint32_t>(neighbors.size());
+    }
+
+    Graphs::BinaryFileHeader header = {};
+    header.directionality = graph.getDirectionality() == Graphs::GraphDirectionality::directed ? 1 : 0;
+    header.isWeighted = std::ranges::any_of(weights, [](auto weight) { return weight != 1; }) ? 1 : 0;
+    header.nodesCount = mapping.size();
+    header.edgesCount = neighbors.size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeAlignedArray(out, offsets);
+    writeAlignedArray(out, neighbors);
+    if (header.isWeighted)
+    {
+        writeAlignedArray(out, weights);
     }
-    out << makeGraphMlClosing();
-    return out.str();
 }
 } // namespace
 
@@ -118,7 +246,17 @@ void Serializer::serializeGraphMlFile(std::ostream& file, const Graph& graph)
     {
         throw std::runtime_error("[Serializer] Error accessing file");
     }
-    file << processGraphIntoGraphMlRepresentation(graph);
+    writeGraphMlRepresentation(file, graph);
+    file.flush();
+}
+
+void Serializer::serializeBinaryFile(std::ostream& file, const GraphReader& graph)
+{
+    if (not file.good())
+    {
+        throw std::runtime_error("[Serializer] Error accessing file");
+    }
+    writeBinaryRepresentation(file, graph);
     file.flush();
 }
 } // namespace Graphs
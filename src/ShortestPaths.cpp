@@ -0,0 +1,1531 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <format>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <Graphs/ShortestPaths.hpp>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Graphs::Algorithm
+{
+namespace
+{
+void ostreamDeleter(std::ostream* out)
+{
+    if (out != &std::cout)
+    {
+        delete out;
+    }
+}
+
+template <bool isVerbose, class... Args>
+void log(std::ostream& outStream, std::string formatString, Args... args)
+{
+    if constexpr (not isVerbose)
+    {
+        return;
+    }
+    else
+    {
+        if constexpr (sizeof...(args) == 0)
+        {
+            outStream << formatString;
+        }
+        else
+        {
+            outStream << std::vformat(formatString, std::make_format_args(args...));
+        }
+    }
+}
+
+struct QueueEntry
+{
+    Distance distance;
+    uint32_t index;
+};
+
+// Binary heap which never decreases keys; an improved distance is pushed again and the stale entry skipped later.
+class BinaryHeapQueue
+{
+public:
+    explicit BinaryHeapQueue(uint32_t)
+    {}
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    void push(uint32_t index, Distance distance)
+    {
+        heap.emplace(distance, index);
+    }
+
+    QueueEntry pop()
+    {
+        auto [distance, index] = heap.top();
+        heap.pop();
+        return {distance, index};
+    }
+
+private:
+    using Entry = std::pair<Distance, uint32_t>;
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap = {};
+};
+
+/*  Pairing heap over a pool of nodes indexed like the graph nodes. Pushing a node
+    already in the heap decreases its key: its subtree is cut off and melded with
+    the root. Popping melds the children of the root in two passes.
+*/
+class PairingHeapQueue
+{
+public:
+    explicit PairingHeapQueue(uint32_t nodesCount) : nodes(nodesCount)
+    {}
+
+    bool empty() const
+    {
+        return root == none;
+    }
+
+    void push(uint32_t index, Distance distance)
+    {
+        auto& node = nodes[index];
+        if (node.isQueued)
+        {
+            node.distance = distance;
+            if (index != root)
+            {
+                detach(index);
+                root = meld(root, index);
+            }
+            return;
+        }
+
+        node = {.distance = distance, .isQueued = true};
+        root = root == none ? index : meld(root, index);
+    }
+
+    QueueEntry pop()
+    {
+        auto top = root;
+        nodes[top].isQueued = false;
+        root = mergePairs(nodes[top].child);
+        nodes[top].child = none;
+        return {nodes[top].distance, top};
+    }
+
+private:
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    struct Node
+    {
+        Distance distance = 0;
+        uint32_t child = none;
+        uint32_t sibling = none;
+        // Parent for the first child, left sibling for the others.
+        uint32_t previous = none;
+        bool isQueued = false;
+    };
+
+    // Links two roots, the one of the larger distance becoming the first child of the other.
+    uint32_t meld(uint32_t lhs, uint32_t rhs)
+    {
+        if (nodes[rhs].distance < nodes[lhs].distance)
+        {
+            std::swap(lhs, rhs);
+        }
+        auto& parent = nodes[lhs];
+        auto& child = nodes[rhs];
+        child.sibling = parent.child;
+        if (parent.child != none)
+        {
+            nodes[parent.child].previous = rhs;
+        }
+        child.previous = lhs;
+        parent.child = rhs;
+        parent.sibling = none;
+        parent.previous = none;
+        return lhs;
+    }
+
+    void detach(uint32_t index)
+    {
+        auto& node = nodes[index];
+        auto& previous = nodes[node.previous];
+        if (previous.child == index)
+        {
+            previous.child = node.sibling;
+        }
+        else
+        {
+            previous.sibling = node.sibling;
+        }
+        if (node.sibling != none)
+        {
+            nodes[node.sibling].previous = node.previous;
+        }
+        node.sibling = none;
+        node.previous = none;
+    }
+
+    uint32_t mergePairs(uint32_t first)
+    {
+        pairs.clear();
+        while (first != none)
+        {
+            auto second = nodes[first].sibling;
+            auto next = second != none ? nodes[second].sibling : none;
+            nodes[first].sibling = nodes[first].previous = none;
+            if (second == none)
+            {
+                pairs.push_back(first);
+                break;
+            }
+            nodes[second].sibling = nodes[second].previous = none;
+            pairs.push_back(meld(first, second));
+            first = next;
+        }
+
+        if (pairs.empty())
+        {
+            return none;
+        }
+        auto merged = pairs.back();
+        for (auto pair = pairs.size() - 1; pair-- > 0;)
+        {
+            merged = meld(pairs[pair], merged);
+        }
+        return merged;
+    }
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> pairs = {};
+    uint32_t root = none;
+};
+
+/*  Radix heap for monotone integer keys. An entry lives in the bucket of the
+    highest bit in which its distance differs from the last popped one. When the
+    exact bucket runs empty, the first non-empty one is redistributed around its
+    minimum, which moves every entry at most once per bit.
+*/
+class RadixHeapQueue
+{
+public:
+    explicit RadixHeapQueue(uint32_t)
+    {}
+
+    bool empty() const
+    {
+        return entriesCount == 0;
+    }
+
+    void push(uint32_t index, Distance distance)
+    {
+        buckets[bucketOf(distance)].push_back({distance, index});
+        ++entriesCount;
+    }
+
+    QueueEntry pop()
+    {
+        if (buckets.front().empty())
+        {
+            auto bucket = std::ranges::find_if(buckets, [](const auto& entries) {
+                return not entries.empty();
+            });
+            lastPopped = std::ranges::min(*bucket, {}, &QueueEntry::distance).distance;
+            for (const auto& entry : *bucket)
+            {
+                buckets[bucketOf(entry.distance)].push_back(entry);
+            }
+            bucket->clear();
+        }
+
+        auto entry = buckets.front().back();
+        buckets.front().pop_back();
+        --entriesCount;
+        return entry;
+    }
+
+private:
+    std::size_t bucketOf(Distance distance) const
+    {
+        auto differingBits = static_cast<uint64_t>(distance) ^ static_cast<uint64_t>(lastPopped);
+        return differingBits == 0 ? 0 : std::bit_width(differingBits);
+    }
+
+    std::array<std::vector<QueueEntry>, 65> buckets = {};
+    Distance lastPopped = 0;
+    std::size_t entriesCount = 0;
+};
+
+template <typename Queue>
+void settleDistances(const GraphReader& graph,
+                     const NodeIndexMapping& nodeIndexMapping,
+                     uint32_t sourceIndex,
+                     std::vector<Distance>& distances,
+                     std::vector<NodeId>& predecessors)
+{
+    Queue queue(nodeIndexMapping.size());
+    distances[sourceIndex] = 0;
+    queue.push(sourceIndex, 0);
+
+    while (not queue.empty())
+    {
+        auto [distance, index] = queue.pop();
+        if (distance > distances[index])
+        {
+            continue;
+        }
+
+        auto node = nodeIndexMapping.idOf(index);
+        graph.forEachOutgoingEdge(node, [&](NodeId neighbor, WeightType weight) {
+            if (weight < 0)
+            {
+                throw std::invalid_argument{"Dijkstra's algorithm requires non-negative edge weights"};
+            }
+            auto neighborIndex = nodeIndexMapping.indexOf(neighbor);
+            if (auto candidate = distance + weight; candidate < distances[neighborIndex])
+            {
+                distances[neighborIndex] = candidate;
+                predecessors[neighborIndex] = node;
+                queue.push(neighborIndex, candidate);
+            }
+        });
+    }
+}
+
+ShortestPathsVector createPathsTable(const NodeIndexMapping& nodeIndexMapping,
+                                     const std::vector<Distance>& distances,
+                                     const std::vector<NodeId>& predecessors)
+{
+    ShortestPathsVector paths = {};
+    paths.reserve(nodeIndexMapping.size());
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); index++)
+    {
+        paths.emplace_back(nodeIndexMapping.idOf(index), distances[index], predecessors[index]);
+    }
+    return paths;
+}
+
+constexpr uint32_t noIndex = std::numeric_limits<uint32_t>::max();
+
+// Side of the edges by which the weighted adjacency groups them.
+enum class EdgeDirection
+{
+    outgoing,
+    incomming
+};
+
+// Outgoing or incomming edges of every node by dense index, with their weights.
+struct WeightedAdjacency
+{
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> neighbors;
+    std::vector<WeightType> weights;
+};
+
+WeightedAdjacency buildWeightedAdjacency(const GraphReader& graph,
+                                         const NodeIndexMapping& nodeIndexMapping,
+                                         EdgeDirection direction)
+{
+    auto forEachEdge = [&](auto visitor) {
+        for (uint32_t index = 0; index < nodeIndexMapping.size(); index++)
+        {
+            graph.forEachOutgoingEdge(nodeIndexMapping.idOf(index), [&](NodeId neighbor, WeightType weight) {
+                auto neighborIndex = nodeIndexMapping.indexOf(neighbor);
+                if (direction == EdgeDirection::outgoing)
+                {
+                    visitor(index, neighborIndex, weight);
+                }
+                else
+                {
+                    visitor(neighborIndex, index, weight);
+                }
+            });
+        }
+    };
+
+    WeightedAdjacency adjacency = {std::vector<uint32_t>(nodeIndexMapping.size() + 1, 0), {}, {}};
+    auto& offsets = adjacency.offsets;
+    forEachEdge([&offsets](uint32_t owner, uint32_t, WeightType) {
+        ++offsets[owner + 1];
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    adjacency.neighbors.resize(offsets.back());
+    adjacency.weights.resize(offsets.back());
+    auto cursors = offsets;
+    forEachEdge([&adjacency, &cursors](uint32_t owner, uint32_t neighbor, WeightType weight) {
+        auto position = cursors[owner]++;
+        adjacency.neighbors[position] = neighbor;
+        adjacency.weights[position] = weight;
+    });
+    return adjacency;
+}
+
+/*  Follows predecessors from the given node until a node repeats. A cycle of the
+    predecessor graph always has a negative weight, as the distance of every node
+    on it dropped below the one its predecessor offers. Returns the cycle in the
+    direction of its edges, starting from its smallest id, or nothing if the walk
+    ends at the source.
+*/
+NegativeCycle findPredecessorCycle(uint32_t start,
+                                   const std::vector<uint32_t>& predecessors,
+                                   const NodeIndexMapping& nodeIndexMapping)
+{
+    std::vector<char> isVisited(predecessors.size(), false);
+    auto index = start;
+    while (index != noIndex and not isVisited[index])
+    {
+        isVisited[index] = true;
+        index = predecessors[index];
+    }
+    if (index == noIndex)
+    {
+        return {};
+    }
+
+    NegativeCycle cycle = {};
+    auto cycleIndex = index;
+    do
+    {
+        cycle.push_back(nodeIndexMapping.idOf(cycleIndex));
+        cycleIndex = predecessors[cycleIndex];
+    } while (cycleIndex != index);
+    std::ranges::reverse(cycle);
+    std::ranges::rotate(cycle, std::ranges::min_element(cycle));
+    return cycle;
+}
+
+/*  SPFA: relaxes outgoing edges of nodes taken from a FIFO queue of the nodes whose
+    distance dropped. A distance reached through as many edges as there are nodes
+    can only come from a negative cycle, which is then searched among predecessors.
+*/
+NegativeCycle relaxFromQueue(const GraphReader& graph,
+                             const NodeIndexMapping& nodeIndexMapping,
+                             uint32_t sourceIndex,
+                             std::vector<Distance>& distances,
+                             std::vector<uint32_t>& predecessors)
+{
+    auto nodesCount = nodeIndexMapping.size();
+    std::vector<uint32_t> pathLengths(nodesCount, 0);
+    std::vector<char> isQueued(nodesCount, false);
+    std::deque<uint32_t> queue = {sourceIndex};
+    distances[sourceIndex] = 0;
+    isQueued[sourceIndex] = true;
+
+    NegativeCycle cycle = {};
+    while (not queue.empty() and cycle.empty())
+    {
+        auto index = queue.front();
+        queue.pop_front();
+        isQueued[index] = false;
+
+        graph.forEachOutgoingEdge(nodeIndexMapping.idOf(index), [&](NodeId neighbor, WeightType weight) {
+            auto neighborIndex = nodeIndexMapping.indexOf(neighbor);
+            auto candidate = distances[index] + weight;
+            if (not cycle.empty() or candidate >= distances[neighborIndex])
+            {
+                return;
+            }
+            distances[neighborIndex] = candidate;
+            predecessors[neighborIndex] = index;
+            pathLengths[neighborIndex] = pathLengths[index] + 1;
+            if (pathLengths[neighborIndex] >= nodesCount)
+            {
+                cycle = findPredecessorCycle(neighborIndex, predecessors, nodeIndexMapping);
+            }
+            if (not isQueued[neighborIndex])
+            {
+                queue.push_back(neighborIndex);
+                isQueued[neighborIndex] = true;
+            }
+        });
+    }
+    return cycle;
+}
+
+/*  Relaxes edges in synchronous rounds. Every node takes the best distance offered
+    by incomming neighbors which changed in the previous round, reading distances of
+    that round only, so threads write disjoint nodes. Returns false if distances
+    still change after as many rounds as there are nodes, which means a negative
+    cycle is reachable.
+*/
+bool relaxInRounds(const WeightedAdjacency& adjacency,
+                   uint32_t sourceIndex,
+                   std::vector<Distance>& distances,
+                   std::vector<uint32_t>& predecessors,
+                   ThreadPool& threadPool)
+{
+    auto nodesCount = static_cast<uint32_t>(distances.size());
+    std::vector<char> isChanged(nodesCount, false);
+    std::vector<char> isChangedNext(nodesCount, false);
+    distances[sourceIndex] = 0;
+    isChanged[sourceIndex] = true;
+    auto nextDistances = distances;
+
+    for (uint32_t round = 0; round < nodesCount; round++)
+    {
+        threadPool.parallelFor(nodesCount, [&](uint32_t begin, uint32_t end) {
+            for (auto index = begin; index < end; index++)
+            {
+                auto best = distances[index];
+                for (auto edge = adjacency.offsets[index]; edge < adjacency.offsets[index + 1]; edge++)
+                {
+                    auto neighbor = adjacency.neighbors[edge];
+                    if (isChanged[neighbor] and distances[neighbor] + adjacency.weights[edge] < best)
+                    {
+                        best = distances[neighbor] + adjacency.weights[edge];
+                        predecessors[index] = neighbor;
+                    }
+                }
+                nextDistances[index] = best;
+                isChangedNext[index] = best < distances[index];
+            }
+        });
+
+        std::swap(distances, nextDistances);
+        std::swap(isChanged, isChangedNext);
+        if (std::ranges::none_of(isChanged, [](char changed) { return changed; }))
+        {
+            return true;
+        }
+        std::ranges::copy(distances, nextDistances.begin());
+    }
+    return false;
+}
+
+/*  Delta-stepping over a weighted adjacency whose rows list light edges first.
+    Every phase first gathers relaxation requests of the processed nodes, then
+    applies them with an atomic minimum, and finally records predecessors and
+    bucket entries of the requests which set the resulting distances. Distances
+    only decrease, so a single request per node can set the final distance of a
+    phase, and the predecessors are written without races.
+*/
+class DeltaSteppingSearch
+{
+public:
+    DeltaSteppingSearch(WeightedAdjacency edges, Distance delta, ThreadPool& threadPool)
+        : adjacency{std::move(edges)},
+          delta{delta},
+          threadPool{threadPool},
+          distances(adjacency.offsets.size() - 1),
+          predecessors(distances.size(), noIndex),
+          lightEdgesEnds(distances.size()),
+          frontierPhases(distances.size(), 0),
+          settledBuckets(distances.size(), noBucket)
+    {
+        for (auto& distance : distances)
+        {
+            distance.store(unreachable, std::memory_order_relaxed);
+        }
+        threadPool.parallelFor(distances.size(), [this](uint32_t begin, uint32_t end) {
+            std::vector<std::pair<uint32_t, WeightType>> heavyEdges = {};
+            for (auto index = begin; index < end; index++)
+            {
+                lightEdgesEnds[index] = moveLightEdgesFirst(index, heavyEdges);
+            }
+        });
+    }
+
+    void run(uint32_t sourceIndex)
+    {
+        distances[sourceIndex].store(0, std::memory_order_relaxed);
+        buckets[0].push_back(sourceIndex);
+
+        while (not buckets.empty())
+        {
+            auto bucket = buckets.begin()->first;
+            std::vector<uint32_t> settled = {};
+            for (auto entries = buckets.find(bucket); entries != buckets.end(); entries = buckets.find(bucket))
+            {
+                auto candidates = std::move(entries->second);
+                buckets.erase(entries);
+                ++phase;
+
+                std::vector<uint32_t> frontier = {};
+                for (auto index : candidates)
+                {
+                    if (bucketOf(distances[index].load(std::memory_order_relaxed)) != bucket
+                        or frontierPhases[index] == phase)
+                    {
+                        continue;
+                    }
+                    frontierPhases[index] = phase;
+                    frontier.push_back(index);
+                    if (settledBuckets[index] != bucket)
+                    {
+                        settledBuckets[index] = bucket;
+                        settled.push_back(index);
+                    }
+                }
+                relax(frontier, EdgeWeight::light);
+            }
+            relax(settled, EdgeWeight::heavy);
+        }
+    }
+
+    std::vector<Distance> getDistances() const
+    {
+        std::vector<Distance> plainDistances(distances.size());
+        for (std::size_t index = 0; index < distances.size(); index++)
+        {
+            plainDistances[index] = distances[index].load(std::memory_order_relaxed);
+        }
+        return plainDistances;
+    }
+
+    const std::vector<uint32_t>& getPredecessors() const
+    {
+        return predecessors;
+    }
+
+    uint32_t phasesCount() const
+    {
+        return phase;
+    }
+
+private:
+    static constexpr uint64_t noBucket = std::numeric_limits<uint64_t>::max();
+
+    enum class EdgeWeight
+    {
+        light,
+        heavy
+    };
+
+    struct Request
+    {
+        uint32_t target;
+        Distance distance;
+        uint32_t source;
+    };
+
+    uint64_t bucketOf(Distance distance) const
+    {
+        return static_cast<uint64_t>(distance / delta);
+    }
+
+    uint32_t moveLightEdgesFirst(uint32_t index, std::vector<std::pair<uint32_t, WeightType>>& heavyEdges)
+    {
+        heavyEdges.clear();
+        auto lightEnd = adjacency.offsets[index];
+        for (auto edge = adjacency.offsets[index]; edge < adjacency.offsets[index + 1]; edge++)
+        {
+            if (adjacency.weights[edge] <= delta)
+            {
+                adjacency.neighbors[lightEnd] = adjacency.neighbors[edge];
+                adjacency.weights[lightEnd] = adjacency.weights[edge];
+                ++lightEnd;
+            }
+            else
+            {
+                heavyEdges.emplace_back(adjacency.neighbors[edge], adjacency.weights[edge]);
+            }
+        }
+        for (std::size_t heavy = 0; heavy < heavyEdges.size(); heavy++)
+        {
+            std::tie(adjacency.neighbors[lightEnd + heavy], adjacency.weights[lightEnd + heavy]) = heavyEdges[heavy];
+        }
+        return lightEnd;
+    }
+
+    bool lowerDistance(uint32_t index, Distance candidate)
+    {
+        auto current = distances[index].load(std::memory_order_relaxed);
+        while (candidate < current)
+        {
+            if (distances[index].compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void relax(const std::vector<uint32_t>& nodes, EdgeWeight edgeWeight)
+    {
+        std::vector<Request> requests = {};
+        std::mutex requestsMutex = {};
+        threadPool.parallelFor(nodes.size(), [&](uint32_t begin, uint32_t end) {
+            std::vector<Request> localRequests = {};
+            for (auto position = begin; position < end; position++)
+            {
+                auto index = nodes[position];
+                auto distance = distances[index].load(std::memory_order_relaxed);
+                auto firstEdge = edgeWeight == EdgeWeight::light ? adjacency.offsets[index] : lightEdgesEnds[index];
+                auto lastEdge = edgeWeight == EdgeWeight::light ? lightEdgesEnds[index] : adjacency.offsets[index + 1];
+                for (auto edge = firstEdge; edge < lastEdge; edge++)
+                {
+                    auto neighbor = adjacency.neighbors[edge];
+                    auto candidate = distance + adjacency.weights[edge];
+                    if (candidate < distances[neighbor].load(std::memory_order_relaxed))
+                    {
+                        localRequests.push_back({neighbor, candidate, index});
+                    }
+                }
+            }
+            std::scoped_lock lock{requestsMutex};
+            requests.insert(requests.end(), localRequests.begin(), localRequests.end());
+        });
+
+        std::vector<char> isApplied(requests.size(), false);
+        threadPool.parallelFor(requests.size(), [&](uint32_t begin, uint32_t end) {
+            for (auto request = begin; request < end; request++)
+            {
+                isApplied[request] = lowerDistance(requests[request].target, requests[request].distance);
+            }
+        });
+
+        threadPool.parallelFor(requests.size(), [&](uint32_t begin, uint32_t end) {
+            std::vector<std::pair<uint64_t, uint32_t>> entries = {};
+            for (auto request = begin; request < end; request++)
+            {
+                auto [target, distance, source] = requests[request];
+                if (isApplied[request] and distances[target].load(std::memory_order_relaxed) == distance)
+                {
+                    predecessors[target] = source;
+                    entries.emplace_back(bucketOf(distance), target);
+                }
+            }
+            std::scoped_lock lock{requestsMutex};
+            for (auto [bucket, target] : entries)
+            {
+                buckets[bucket].push_back(target);
+            }
+        });
+    }
+
+    WeightedAdjacency adjacency;
+    Distance delta;
+    ThreadPool& threadPool;
+    std::vector<std::atomic<Distance>> distances;
+    std::vector<uint32_t> predecessors;
+    std::vector<uint32_t> lightEdgesEnds;
+    std::vector<uint32_t> frontierPhases;
+    std::vector<uint64_t> settledBuckets;
+    std::map<uint64_t, std::vector<uint32_t>> buckets = {};
+    uint32_t phase = 0;
+};
+
+Distance chooseDelta(const WeightedAdjacency& adjacency)
+{
+    auto edgesCount = adjacency.weights.size();
+    if (edgesCount == 0)
+    {
+        return 1;
+    }
+    Distance maxWeight = std::ranges::max(adjacency.weights);
+    auto nodesCount = static_cast<Distance>(adjacency.offsets.size() - 1);
+    return std::max<Distance>(1, maxWeight * nodesCount / static_cast<Distance>(edgesCount));
+}
+
+std::vector<NodeId> toPredecessorIds(const NodeIndexMapping& nodeIndexMapping,
+                                     const std::vector<uint32_t>& predecessors)
+{
+    std::vector<NodeId> predecessorIds(predecessors.size(), noPredecessor);
+    for (std::size_t index = 0; index < predecessors.size(); index++)
+    {
+        if (predecessors[index] != noIndex)
+        {
+            predecessorIds[index] = nodeIndexMapping.idOf(predecessors[index]);
+        }
+    }
+    return predecessorIds;
+}
+
+// Three tiles of this side fit in the L1 cache, as well as a whole number of AVX2 registers in a tile row.
+constexpr uint32_t tileSize = 32;
+// Missing path inside the tiled matrix, low enough to have any path length added without overflow.
+constexpr Distance tiledInfinity = unreachable / 4;
+
+// Distances and next hops of the tiled Floyd-Warshall, padded with isolated nodes to whole tiles.
+struct TiledDistances
+{
+    uint32_t tilesPerRow;
+    uint32_t stride;
+    std::vector<Distance> distances;
+    std::vector<uint32_t> nextHops;
+};
+
+TiledDistances buildTiledDistances(const GraphReader& graph, const NodeIndexMapping& nodeIndexMapping, bool withPaths)
+{
+    auto tilesPerRow = (nodeIndexMapping.size() + tileSize - 1) / tileSize;
+    auto stride = tilesPerRow * tileSize;
+    auto cellsCount = static_cast<std::size_t>(stride) * stride;
+    TiledDistances matrix = {tilesPerRow, stride, std::vector<Distance>(cellsCount, tiledInfinity), {}};
+    if (withPaths)
+    {
+        matrix.nextHops.assign(cellsCount, noIndex);
+    }
+
+    for (uint32_t index = 0; index < stride; index++)
+    {
+        auto cell = static_cast<std::size_t>(index) * stride + index;
+        matrix.distances[cell] = 0;
+        if (withPaths)
+        {
+            matrix.nextHops[cell] = index;
+        }
+    }
+    for (uint32_t index = 0; index < nodeIndexMapping.size(); index++)
+    {
+        graph.forEachOutgoingEdge(nodeIndexMapping.idOf(index), [&](NodeId neighbor, WeightType weight) {
+            auto neighborIndex = nodeIndexMapping.indexOf(neighbor);
+            auto cell = static_cast<std::size_t>(index) * stride + neighborIndex;
+            if (weight < matrix.distances[cell])
+            {
+                matrix.distances[cell] = weight;
+                if (withPaths)
+                {
+                    matrix.nextHops[cell] = neighborIndex;
+                }
+            }
+        });
+    }
+    return matrix;
+}
+
+// Min-plus update of a tile row: row[j] = min(row[j], toPivot + pivotRow[j]), taking the next hop towards the pivot.
+template <bool withPaths>
+void relaxTileRow(Distance* row, uint32_t* nextHops, const Distance* pivotRow, Distance toPivot, uint32_t hopToPivot)
+{
+    uint32_t column = 0;
+#if defined(__AVX2__)
+    const auto toPivotLanes = _mm256_set1_epi64x(toPivot);
+    const auto hopLanes = _mm_set1_epi32(static_cast<int>(hopToPivot));
+    // Picks the low halves of the 64-bit comparison masks to blend 32-bit next hops.
+    const auto lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    for (; column + 4 <= tileSize; column += 4)
+    {
+        auto current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + column));
+        auto candidate = _mm256_add_epi64(toPivotLanes,
+                                          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pivotRow + column)));
+        auto isShorter = _mm256_cmpgt_epi64(current, candidate);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + column),
+                            _mm256_blendv_epi8(current, candidate, isShorter));
+        if constexpr (withPaths)
+        {
+            auto isShorterHalves = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(isShorter, lowHalves));
+            auto hops = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nextHops + column));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(nextHops + column),
+                             _mm_blendv_epi8(hops, hopLanes, isShorterHalves));
+        }
+    }
+#endif
+    for (; column < tileSize; column++)
+    {
+        auto candidate = toPivot + pivotRow[column];
+        if constexpr (withPaths)
+        {
+            if (candidate < row[column])
+            {
+                row[column] = candidate;
+                nextHops[column] = hopToPivot;
+            }
+        }
+        else
+        {
+            row[column] = std::min(row[column], candidate);
+        }
+    }
+}
+
+/*  Relaxes the tile at the given tile row and column through every pivot of the pivot
+    tile, reading paths towards the pivots from the tile in its row and paths from the
+    pivots from the tile in its column. Either of them may be the relaxed tile itself.
+*/
+template <bool withPaths>
+void relaxTile(TiledDistances& matrix, uint32_t tileRow, uint32_t tileColumn, uint32_t pivotTile)
+{
+    auto stride = static_cast<std::size_t>(matrix.stride);
+    auto firstRow = tileRow * tileSize;
+    auto firstColumn = tileColumn * tileSize;
+    for (auto pivot = pivotTile * tileSize; pivot < (pivotTile + 1) * tileSize; pivot++)
+    {
+        const auto* pivotRow = matrix.distances.data() + pivot * stride + firstColumn;
+        for (auto row = firstRow; row < firstRow + tileSize; row++)
+        {
+            auto toPivot = matrix.distances[row * stride + pivot];
+            if (toPivot >= tiledInfinity / 2)
+            {
+                continue;
+            }
+            auto* nextHops = withPaths ? matrix.nextHops.data() + row * stride + firstColumn : nullptr;
+            auto hopToPivot = withPaths ? matrix.nextHops[row * stride + pivot] : noIndex;
+            relaxTileRow<withPaths>(
+                matrix.distances.data() + row * stride + firstColumn, nextHops, pivotRow, toPivot, hopToPivot);
+        }
+    }
+}
+
+// Returns false as soon as a node gets a negative distance to itself, which means a negative cycle.
+template <bool withPaths>
+bool relaxAllTiles(TiledDistances& matrix, uint32_t nodesCount, ThreadPool& threadPool)
+{
+    auto tilesPerRow = matrix.tilesPerRow;
+    for (uint32_t pivotTile = 0; pivotTile < tilesPerRow; pivotTile++)
+    {
+        relaxTile<withPaths>(matrix, pivotTile, pivotTile, pivotTile);
+
+        threadPool.parallelFor(tilesPerRow * 2, [&](uint32_t begin, uint32_t end) {
+            for (auto task = begin; task < end; task++)
+            {
+                auto otherTile = task / 2;
+                if (otherTile == pivotTile)
+                {
+                    continue;
+                }
+                if (task % 2 == 0)
+                {
+                    relaxTile<withPaths>(matrix, pivotTile, otherTile, pivotTile);
+                }
+                else
+                {
+                    relaxTile<withPaths>(matrix, otherTile, pivotTile, pivotTile);
+                }
+            }
+        });
+
+        threadPool.parallelFor(tilesPerRow * tilesPerRow, [&](uint32_t begin, uint32_t end) {
+            for (auto task = begin; task < end; task++)
+            {
+                auto tileRow = task / tilesPerRow;
+                auto tileColumn = task % tilesPerRow;
+                if (tileRow != pivotTile and tileColumn != pivotTile)
+                {
+                    relaxTile<withPaths>(matrix, tileRow, tileColumn, pivotTile);
+                }
+            }
+        });
+
+        for (std::size_t index = 0; index < nodesCount; index++)
+        {
+            if (matrix.distances[index * matrix.stride + index] < 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+DistanceMatrix toDistanceMatrix(const TiledDistances& matrix, const NodeIndexMapping& nodeIndexMapping)
+{
+    auto nodesCount = static_cast<std::size_t>(nodeIndexMapping.size());
+    DistanceMatrix result = {nodeIndexMapping.ids(), std::vector<Distance>(nodesCount * nodesCount), {}};
+    if (not matrix.nextHops.empty())
+    {
+        result.nextHops.resize(nodesCount * nodesCount);
+    }
+
+    for (std::size_t row = 0; row < nodesCount; row++)
+    {
+        for (std::size_t column = 0; column < nodesCount; column++)
+        {
+            auto distance = matrix.distances[row * matrix.stride + column];
+            auto isReachable = distance < tiledInfinity / 2;
+            result.distances[row * nodesCount + column] = isReachable ? distance : unreachable;
+            if (not result.nextHops.empty())
+            {
+                result.nextHops[row * nodesCount + column]
+                    = isReachable ? matrix.nextHops[row * matrix.stride + column] : noIndex;
+            }
+        }
+    }
+    return result;
+}
+
+// One bit per search of a batch, 64 searches a word.
+template <std::size_t wordsCount>
+struct SearchMask
+{
+    std::array<uint64_t, wordsCount> words = {};
+
+    bool operator==(const SearchMask&) const = default;
+
+    SearchMask& operator|=(const SearchMask& other)
+    {
+        for (std::size_t word = 0; word < wordsCount; word++)
+        {
+            words[word] |= other.words[word];
+        }
+        return *this;
+    }
+
+    SearchMask without(const SearchMask& other) const
+    {
+        SearchMask difference = {};
+        for (std::size_t word = 0; word < wordsCount; word++)
+        {
+            difference.words[word] = words[word] & ~other.words[word];
+        }
+        return difference;
+    }
+
+    bool any() const
+    {
+        return std::ranges::any_of(words, [](uint64_t word) { return word != 0; });
+    }
+
+    template <typename Visitor>
+    void forEachSearch(Visitor visitor) const
+    {
+        for (uint32_t word = 0; word < wordsCount; word++)
+        {
+            for (auto bits = words[word]; bits != 0; bits &= bits - 1)
+            {
+                visitor(word * 64 + std::countr_zero(bits));
+            }
+        }
+    }
+};
+
+/*  Runs the searches from a batch of sources level by level, filling the rows of the
+    batch in the hop matrix. Every node pulls the visiting masks of its incomming
+    neighbors, given by dense index through the callable, and keeps the searches
+    which have not seen it yet, so threads only write their own nodes.
+*/
+template <std::size_t wordsCount, typename IncommingNeighbors>
+void searchFromBatch(const IncommingNeighbors& forEachIncommingNeighbor,
+                     std::span<const uint32_t> sourceIndexes,
+                     uint32_t nodesCount,
+                     std::span<HopCount> hopRows,
+                     ThreadPool& threadPool)
+{
+    using Mask = SearchMask<wordsCount>;
+    std::vector<Mask> seen(nodesCount);
+    std::vector<Mask> visiting(nodesCount);
+    std::vector<Mask> visitingNext(nodesCount);
+    Mask allSearches = {};
+    for (uint32_t search = 0; search < sourceIndexes.size(); search++)
+    {
+        Mask searchMask = {};
+        searchMask.words[search / 64] = uint64_t{1} << (search % 64);
+        seen[sourceIndexes[search]] |= searchMask;
+        visiting[sourceIndexes[search]] |= searchMask;
+        allSearches |= searchMask;
+        hopRows[static_cast<std::size_t>(search) * nodesCount + sourceIndexes[search]] = 0;
+    }
+
+    std::atomic<bool> isAnyVisiting = true;
+    for (HopCount level = 1; isAnyVisiting.load(std::memory_order_relaxed); level++)
+    {
+        isAnyVisiting.store(false, std::memory_order_relaxed);
+        threadPool.parallelFor(nodesCount, [&](uint32_t begin, uint32_t end) {
+            auto isChunkVisiting = false;
+            for (auto index = begin; index < end; index++)
+            {
+                visitingNext[index] = {};
+                if (seen[index] == allSearches)
+                {
+                    continue;
+                }
+
+                Mask reached = {};
+                forEachIncommingNeighbor(index, [&reached, &visiting](uint32_t neighbor) {
+                    reached |= visiting[neighbor];
+                });
+                auto discovered = reached.without(seen[index]);
+                if (not discovered.any())
+                {
+                    continue;
+                }
+                seen[index] |= discovered;
+                visitingNext[index] = discovered;
+                discovered.forEachSearch([&](uint32_t search) {
+                    hopRows[static_cast<std::size_t>(search) * nodesCount + index] = level;
+                });
+                isChunkVisiting = true;
+            }
+            if (isChunkVisiting)
+            {
+                isAnyVisiting.store(true, std::memory_order_relaxed);
+            }
+        });
+        std::swap(visiting, visitingNext);
+    }
+}
+
+// Visits incomming neighbors of a CSR graph by dense index, straight from its rows.
+template <GraphDirectionality directionality>
+auto csrIncommingNeighbors(const CsrGraph<directionality>& graph, const NodeIndexMapping& nodeIndexMapping)
+{
+    return [&graph, &nodeIndexMapping](uint32_t index, auto&& visitor) {
+        for (auto neighbor : graph.getIncommingNeighborsView(nodeIndexMapping.idOf(index)))
+        {
+            visitor(nodeIndexMapping.indexOf(neighbor));
+        }
+    };
+}
+
+template <bool isVerbose>
+void printPaths(std::ostream& out, const ShortestPathsVector& paths)
+{
+    for (const auto& [node, distance, predecessor] : paths)
+    {
+        if (distance == unreachable)
+        {
+            log<isVerbose>(out, "Node {} is unreachable\n", node);
+        }
+        else
+        {
+            log<isVerbose>(out, "Node {} at distance {} through node {}\n", node, distance, predecessor);
+        }
+    }
+}
+} // namespace
+
+template <bool isVerbose>
+void Dijkstra<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    auto sourceIndex = nodeIndexMapping.indexOf(source);
+    if (sourceIndex == NodeIndexMapping::invalidIndex)
+    {
+        log<isVerbose>(*outStream, "Source node {} does not exist, shortest paths are not available\n", source);
+        return;
+    }
+
+    log<isVerbose>(*outStream,
+                   "Dijkstra's algorithm from node {} in graph with {} nodes\n",
+                   source,
+                   graph.nodesAmount());
+
+    std::vector<Distance> distances(nodeIndexMapping.size(), unreachable);
+    std::vector<NodeId> predecessors(nodeIndexMapping.size(), noPredecessor);
+    switch (queueType)
+    {
+        case PriorityQueueType::binaryHeap:
+            settleDistances<BinaryHeapQueue>(graph, nodeIndexMapping, sourceIndex, distances, predecessors);
+            break;
+        case PriorityQueueType::pairingHeap:
+            settleDistances<PairingHeapQueue>(graph, nodeIndexMapping, sourceIndex, distances, predecessors);
+            break;
+        case PriorityQueueType::radixHeap:
+            settleDistances<RadixHeapQueue>(graph, nodeIndexMapping, sourceIndex, distances, predecessors);
+            break;
+    }
+
+    auto& [resultSource, paths] = *result;
+    resultSource = source;
+    paths = createPathsTable(nodeIndexMapping, distances, predecessors);
+    printPaths<isVerbose>(*outStream, paths);
+
+    log<isVerbose>(*outStream, "Dijkstra's algorithm completed\n");
+}
+
+template <bool isVerbose>
+Dijkstra<isVerbose>::Dijkstra(std::shared_ptr<ShortestPathsResult> resultContainer,
+                              NodeId source,
+                              std::ostream& out,
+                              PriorityQueueType queueType)
+    : result(std::move(resultContainer)), outStream{&out, ostreamDeleter}, source{source}, queueType{queueType}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Shortest paths result cannot be null");
+        throw std::invalid_argument{"Shortest paths result cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string Dijkstra<isVerbose>::getName()
+{
+    // Names the queue as well, so benchmarks of the queues against each other tell them apart.
+    switch (queueType)
+    {
+        case PriorityQueueType::pairingHeap:
+            return "Dijkstra's algorithm (pairing heap)";
+        case PriorityQueueType::radixHeap:
+            return "Dijkstra's algorithm (radix heap)";
+        case PriorityQueueType::binaryHeap:
+            break;
+    }
+    return "Dijkstra's algorithm (binary heap)";
+}
+
+template class Dijkstra<verbose>;
+template class Dijkstra<notVerbose>;
+
+template <bool isVerbose>
+void BellmanFord<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    auto sourceIndex = nodeIndexMapping.indexOf(source);
+    if (sourceIndex == NodeIndexMapping::invalidIndex)
+    {
+        log<isVerbose>(*outStream, "Source node {} does not exist, shortest paths are not available\n", source);
+        return;
+    }
+
+    log<isVerbose>(*outStream,
+                   "Bellman-Ford algorithm from node {} in graph with {} nodes\n",
+                   source,
+                   graph.nodesAmount());
+
+    std::vector<Distance> distances(nodeIndexMapping.size(), unreachable);
+    std::vector<uint32_t> predecessors(nodeIndexMapping.size(), noIndex);
+    NegativeCycle cycle = {};
+    if (mode == RelaxationMode::parallelRounds)
+    {
+        auto adjacency = buildWeightedAdjacency(graph, nodeIndexMapping, EdgeDirection::incomming);
+        if (not relaxInRounds(adjacency, sourceIndex, distances, predecessors, threadPool))
+        {
+            // Rounds only prove that a negative cycle exists; the queue-based pass finds its nodes.
+            std::ranges::fill(distances, unreachable);
+            std::ranges::fill(predecessors, noIndex);
+            cycle = relaxFromQueue(graph, nodeIndexMapping, sourceIndex, distances, predecessors);
+        }
+    }
+    else
+    {
+        cycle = relaxFromQueue(graph, nodeIndexMapping, sourceIndex, distances, predecessors);
+    }
+
+    if (not cycle.empty())
+    {
+        log<isVerbose>(*outStream, "Found negative cycle through {} nodes\n", cycle.size());
+        *negativeCycle = std::move(cycle);
+        return;
+    }
+
+    negativeCycle->clear();
+    auto& [resultSource, paths] = *result;
+    resultSource = source;
+    paths = createPathsTable(nodeIndexMapping, distances, toPredecessorIds(nodeIndexMapping, predecessors));
+    printPaths<isVerbose>(*outStream, paths);
+
+    log<isVerbose>(*outStream, "Bellman-Ford algorithm completed\n");
+}
+
+template <bool isVerbose>
+BellmanFord<isVerbose>::BellmanFord(std::shared_ptr<ShortestPathsResult> resultContainer,
+                                    std::shared_ptr<NegativeCycle> negativeCycleContainer,
+                                    NodeId source,
+                                    std::ostream& out,
+                                    RelaxationMode mode,
+                                    uint32_t threadsCount)
+    : result(std::move(resultContainer)),
+      negativeCycle(std::move(negativeCycleContainer)),
+      outStream{&out, ostreamDeleter},
+      source{source},
+      mode{mode},
+      threadPool{mode == RelaxationMode::parallelRounds ? threadsCount : 1}
+{
+    if (not result or not negativeCycle)
+    {
+        log<isVerbose>(*outStream, "Shortest paths result and negative cycle cannot be null");
+        throw std::invalid_argument{"Shortest paths result and negative cycle cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string BellmanFord<isVerbose>::getName()
+{
+    return "Bellman-Ford algorithm";
+}
+
+template class BellmanFord<verbose>;
+template class BellmanFord<notVerbose>;
+
+template <bool isVerbose>
+void DeltaStepping<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    auto sourceIndex = nodeIndexMapping.indexOf(source);
+    if (sourceIndex == NodeIndexMapping::invalidIndex)
+    {
+        log<isVerbose>(*outStream, "Source node {} does not exist, shortest paths are not available\n", source);
+        return;
+    }
+
+    auto adjacency = buildWeightedAdjacency(graph, nodeIndexMapping, EdgeDirection::outgoing);
+    if (std::ranges::any_of(adjacency.weights, [](WeightType weight) { return weight < 0; }))
+    {
+        throw std::invalid_argument{"Delta-stepping requires non-negative edge weights"};
+    }
+    auto bucketWidth = delta != 0 ? delta : chooseDelta(adjacency);
+
+    log<isVerbose>(*outStream,
+                   "Delta-stepping from node {} in graph with {} nodes using {} threads and delta {}\n",
+                   source,
+                   graph.nodesAmount(),
+                   threadPool.size(),
+                   bucketWidth);
+
+    DeltaSteppingSearch search(std::move(adjacency), bucketWidth, threadPool);
+    search.run(sourceIndex);
+
+    auto& [resultSource, paths] = *result;
+    resultSource = source;
+    paths = createPathsTable(nodeIndexMapping,
+                             search.getDistances(),
+                             toPredecessorIds(nodeIndexMapping, search.getPredecessors()));
+    printPaths<isVerbose>(*outStream, paths);
+
+    log<isVerbose>(*outStream, "Delta-stepping completed in {} phases\n", search.phasesCount());
+}
+
+template <bool isVerbose>
+DeltaStepping<isVerbose>::DeltaStepping(std::shared_ptr<ShortestPathsResult> resultContainer,
+                                        NodeId source,
+                                        std::ostream& out,
+                                        Distance delta,
+                                        uint32_t threadsCount)
+    : result(std::move(resultContainer)),
+      outStream{&out, ostreamDeleter},
+      source{source},
+      delta{delta},
+      threadPool{threadsCount}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Shortest paths result cannot be null");
+        throw std::invalid_argument{"Shortest paths result cannot be null"};
+    }
+    if (delta < 0)
+    {
+        log<isVerbose>(*outStream, "Delta cannot be negative");
+        throw std::invalid_argument{"Delta cannot be negative"};
+    }
+}
+
+template <bool isVerbose>
+std::string DeltaStepping<isVerbose>::getName()
+{
+    return "Delta-stepping";
+}
+
+template class DeltaStepping<verbose>;
+template class DeltaStepping<notVerbose>;
+
+Distance DistanceMatrix::distance(NodeId source, NodeId destination) const
+{
+    auto sourceIt = std::ranges::lower_bound(nodes, source);
+    auto destinationIt = std::ranges::lower_bound(nodes, destination);
+    if (sourceIt == nodes.end() or *sourceIt != source or destinationIt == nodes.end() or *destinationIt != destination)
+    {
+        return unreachable;
+    }
+    return distances[(sourceIt - nodes.begin()) * nodes.size() + (destinationIt - nodes.begin())];
+}
+
+std::vector<NodeId> DistanceMatrix::path(NodeId source, NodeId destination) const
+{
+    if (nextHops.empty() or distance(source, destination) == unreachable)
+    {
+        return {};
+    }
+
+    auto index = static_cast<std::size_t>(std::ranges::lower_bound(nodes, source) - nodes.begin());
+    auto destinationIndex = static_cast<std::size_t>(std::ranges::lower_bound(nodes, destination) - nodes.begin());
+    std::vector<NodeId> path = {source};
+    while (index != destinationIndex)
+    {
+        index = nextHops[index * nodes.size() + destinationIndex];
+        path.push_back(nodes[index]);
+    }
+    return path;
+}
+
+template <bool isVerbose>
+void FloydWarshall<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    log<isVerbose>(*outStream,
+                   "Floyd-Warshall algorithm in graph with {} nodes using {} threads\n",
+                   graph.nodesAmount(),
+                   threadPool.size());
+
+    auto matrix = buildTiledDistances(graph, nodeIndexMapping, reconstructPaths);
+    auto isCycleFree = reconstructPaths ? relaxAllTiles<true>(matrix, nodeIndexMapping.size(), threadPool)
+                                        : relaxAllTiles<false>(matrix, nodeIndexMapping.size(), threadPool);
+    if (not isCycleFree)
+    {
+        log<isVerbose>(*outStream, "Found negative cycle, distances are not available\n");
+        *result = {};
+        return;
+    }
+
+    *result = toDistanceMatrix(matrix, nodeIndexMapping);
+    if constexpr (isVerbose)
+    {
+        for (std::size_t row = 0; row < result->nodes.size(); row++)
+        {
+            std::string distances = {};
+            for (std::size_t column = 0; column < result->nodes.size(); column++)
+            {
+                auto distance = result->distances[row * result->nodes.size() + column];
+                distances += distance == unreachable ? " -" : std::format(" {}", distance);
+            }
+            log<isVerbose>(*outStream, "Distances from node {}:{}\n", result->nodes[row], distances);
+        }
+    }
+
+    log<isVerbose>(*outStream, "Floyd-Warshall algorithm completed\n");
+}
+
+template <bool isVerbose>
+FloydWarshall<isVerbose>::FloydWarshall(std::shared_ptr<DistanceMatrix> resultContainer,
+                                        std::ostream& out,
+                                        bool reconstructPaths,
+                                        uint32_t threadsCount)
+    : result(std::move(resultContainer)),
+      outStream{&out, ostreamDeleter},
+      reconstructPaths{reconstructPaths},
+      threadPool{threadsCount}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Distance matrix cannot be null");
+        throw std::invalid_argument{"Distance matrix cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string FloydWarshall<isVerbose>::getName()
+{
+    return "Floyd-Warshall algorithm";
+}
+
+template class FloydWarshall<verbose>;
+template class FloydWarshall<notVerbose>;
+
+HopCount HopMatrix::hopsBetween(NodeId source, NodeId destination) const
+{
+    auto sourceIt = std::ranges::find(sources, source);
+    auto destinationIt = std::ranges::lower_bound(nodes, destination);
+    if (sourceIt == sources.end() or destinationIt == nodes.end() or *destinationIt != destination)
+    {
+        return unreachableHops;
+    }
+    return hops[(sourceIt - sources.begin()) * nodes.size() + (destinationIt - nodes.begin())];
+}
+
+template <bool isVerbose>
+void MultiSourceBfs<isVerbose>::operator()(const Graphs::GraphReader& graph)
+{
+    NodeIndexMapping nodeIndexMapping(graph.getNodeIds());
+    auto searchedSources = sources.empty() ? nodeIndexMapping.ids() : sources;
+    std::vector<uint32_t> sourceIndexes = {};
+    sourceIndexes.reserve(searchedSources.size());
+    for (auto source : searchedSources)
+    {
+        auto sourceIndex = nodeIndexMapping.indexOf(source);
+        if (sourceIndex == NodeIndexMapping::invalidIndex)
+        {
+            log<isVerbose>(*outStream, "Source node {} does not exist, hop counts are not available\n", source);
+            return;
+        }
+        sourceIndexes.push_back(sourceIndex);
+    }
+
+    constexpr std::size_t narrowBatchSize = 64;
+    constexpr std::size_t wideBatchSize = 256;
+    auto batchSize = sourceIndexes.size() > narrowBatchSize ? wideBatchSize : narrowBatchSize;
+    log<isVerbose>(*outStream,
+                   "Multi-source BFS from {} sources in graph with {} nodes using {} threads\n",
+                   sourceIndexes.size(),
+                   graph.nodesAmount(),
+                   threadPool.size());
+
+    auto nodesCount = nodeIndexMapping.size();
+    std::vector<HopCount> hops(sourceIndexes.size() * nodesCount, unreachableHops);
+    auto searchInBatches = [&](const auto& forEachIncommingNeighbor) {
+        for (std::size_t first = 0; first < sourceIndexes.size(); first += batchSize)
+        {
+            auto batch = std::span<const uint32_t>(sourceIndexes).subspan(
+                first, std::min(batchSize, sourceIndexes.size() - first));
+            auto hopRows = std::span(hops).subspan(first * nodesCount, batch.size() * nodesCount);
+            if (batchSize == narrowBatchSize)
+            {
+                searchFromBatch<narrowBatchSize / 64>(forEachIncommingNeighbor, batch, nodesCount, hopRows, threadPool);
+            }
+            else
+            {
+                searchFromBatch<wideBatchSize / 64>(forEachIncommingNeighbor, batch, nodesCount, hopRows, threadPool);
+            }
+        }
+    };
+
+    if (const auto* csrGraph = dynamic_cast<const CsrGraph<GraphDirectionality::directed>*>(&graph))
+    {
+        searchInBatches(csrIncommingNeighbors(*csrGraph, nodeIndexMapping));
+    }
+    else if (const auto* csrGraph = dynamic_cast<const CsrGraph<GraphDirectionality::undirected>*>(&graph))
+    {
+        searchInBatches(csrIncommingNeighbors(*csrGraph, nodeIndexMapping));
+    }
+    else
+    {
+        auto adjacency = buildWeightedAdjacency(graph, nodeIndexMapping, EdgeDirection::incomming);
+        searchInBatches([&adjacency](uint32_t index, auto&& visitor) {
+            for (auto edge = adjacency.offsets[index]; edge < adjacency.offsets[index + 1]; edge++)
+            {
+                visitor(adjacency.neighbors[edge]);
+            }
+        });
+    }
+
+    *result = {std::move(searchedSources), nodeIndexMapping.ids(), std::move(hops)};
+    if constexpr (isVerbose)
+    {
+        for (std::size_t row = 0; row < result->sources.size(); row++)
+        {
+            std::string hopCounts = {};
+            for (std::size_t column = 0; column < nodesCount; column++)
+            {
+                auto hopCount = result->hops[row * nodesCount + column];
+                hopCounts += hopCount == unreachableHops ? " -" : std::format(" {}", hopCount);
+            }
+            log<isVerbose>(*outStream, "Hops from node {}:{}\n", result->sources[row], hopCounts);
+        }
+    }
+
+    log<isVerbose>(*outStream, "Multi-source BFS completed\n");
+}
+
+template <bool isVerbose>
+MultiSourceBfs<isVerbose>::MultiSourceBfs(std::shared_ptr<HopMatrix> resultContainer,
+                                          std::vector<NodeId> sources,
+                                          std::ostream& out,
+                                          uint32_t threadsCount)
+    : result(std::move(resultContainer)),
+      outStream{&out, ostreamDeleter},
+      sources{std::move(sources)},
+      threadPool{threadsCount}
+{
+    if (not result)
+    {
+        log<isVerbose>(*outStream, "Hop matrix cannot be null");
+        throw std::invalid_argument{"Hop matrix cannot be null"};
+    }
+}
+
+template <bool isVerbose>
+std::string MultiSourceBfs<isVerbose>::getName()
+{
+    return "Multi-source BFS";
+}
+
+template class MultiSourceBfs<verbose>;
+template class MultiSourceBfs<notVerbose>;
+} // namespace Graphs::Algorithm
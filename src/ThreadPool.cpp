@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <Graphs/ThreadPool.hpp>
+#include <latch>
+
+namespace Graphs
+{
+uint32_t ThreadPool::defaultThreadsCount()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool(uint32_t threadsCount)
+{
+    auto workersCount = std::max(1u, threadsCount) - 1;
+    workers.reserve(workersCount);
+    for (uint32_t i = 0; i < workersCount; i++)
+    {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(tasksMutex);
+        stopping = true;
+    }
+    tasksAvailable.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+uint32_t ThreadPool::size() const
+{
+    return static_cast<uint32_t>(workers.size()) + 1;
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(tasksMutex);
+            tasksAvailable.wait(lock, [this]() {
+                return stopping or not tasks.empty();
+            });
+            if (tasks.empty())
+            {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallelFor(uint32_t count, const RangeBody& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Several chunks per thread even out the load when iterations differ in cost.
+    constexpr uint32_t chunksPerThread = 4;
+    auto chunkSize = std::max(1u, count / (size() * chunksPerThread));
+    auto chunksCount = (count + chunkSize - 1) / chunkSize;
+    auto helpersCount = std::min<uint32_t>(workers.size(), chunksCount - 1);
+
+    std::atomic<uint32_t> nextChunk = 0;
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    auto processChunks = [&]() {
+        for (auto chunk = nextChunk++; chunk < chunksCount; chunk = nextChunk++)
+        {
+            try
+            {
+                auto begin = chunk * chunkSize;
+                body(begin, std::min(count, begin + chunkSize));
+            }
+            catch (...)
+            {
+                std::scoped_lock lock(errorMutex);
+                if (not firstError)
+                {
+                    firstError = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::latch helpersDone(helpersCount);
+    {
+        std::scoped_lock lock(tasksMutex);
+        for (uint32_t i = 0; i < helpersCount; i++)
+        {
+            tasks.emplace_back([&processChunks, &helpersDone]() {
+                processChunks();
+                helpersDone.count_down();
+            });
+        }
+    }
+    tasksAvailable.notify_all();
+
+    processChunks();
+    helpersDone.wait();
+
+    if (firstError)
+    {
+        std::rethrow_exception(firstError);
+    }
+}
+} // namespace Graphs
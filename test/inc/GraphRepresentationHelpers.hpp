@@ -1,19 +1,62 @@
 #pragma once
 
+#include <Graphs/AdjBitMatrix.hpp>
 #include <Graphs/AdjList.hpp>
 #include <Graphs/AdjMatrix.hpp>
+#include <Graphs/CsrGraph.hpp>
 #include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <utility>
 
 namespace Graphs
 {
 using GraphTypes = ::testing::Types<AdjList<GraphDirectionality::undirected>,
                                     AdjList<GraphDirectionality::directed>,
                                     AdjMatrix<GraphDirectionality::undirected>,
-                                    AdjMatrix<GraphDirectionality::directed>>;
+                                    AdjMatrix<GraphDirectionality::directed>,
+                                    AdjBitMatrix<GraphDirectionality::undirected>,
+                                    AdjBitMatrix<GraphDirectionality::directed>>;
 
-using DirectedGraphTypes
-    = ::testing::Types<AdjList<GraphDirectionality::directed>, AdjMatrix<GraphDirectionality::directed>>;
+using DirectedGraphTypes = ::testing::Types<AdjList<GraphDirectionality::directed>,
+                                            AdjMatrix<GraphDirectionality::directed>,
+                                            AdjBitMatrix<GraphDirectionality::directed>>;
 
-using UndirectedGraphTypes
-    = ::testing::Types<AdjList<GraphDirectionality::undirected>, AdjMatrix<GraphDirectionality::undirected>>;
+using UndirectedGraphTypes = ::testing::Types<AdjList<GraphDirectionality::undirected>,
+                                              AdjMatrix<GraphDirectionality::undirected>,
+                                              AdjBitMatrix<GraphDirectionality::undirected>>;
+
+using CsrGraphTypes = ::testing::Types<CsrGraph<GraphDirectionality::undirected>, CsrGraph<GraphDirectionality::directed>>;
+
+/*  Sets the given amount of edges between uniformly drawn ends, so loops and repeated
+    edges may occur. Weights are drawn from the given range, or left out without one.
+*/
+template <typename GraphType>
+GraphType makeRandomGraph(uint32_t nodesCount,
+                          uint32_t edgesCount,
+                          uint32_t seed,
+                          std::optional<std::pair<WeightType, WeightType>> weightRange = std::nullopt)
+{
+    GraphType graph = {};
+    graph.addNodes(nodesCount);
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<NodeId> nodes{1, nodesCount};
+    std::optional<std::uniform_int_distribution<WeightType>> weights = {};
+    if (weightRange.has_value())
+    {
+        weights.emplace(weightRange->first, weightRange->second);
+    }
+    for (uint32_t i = 0; i < edgesCount; i++)
+    {
+        auto source = nodes(generator);
+        auto destination = nodes(generator);
+        std::optional<WeightType> weight = {};
+        if (weights.has_value())
+        {
+            weight = (*weights)(generator);
+        }
+        graph.setEdge({source, destination, weight});
+    }
+    return graph;
+}
 } // namespace Graphs
@@ -21,4 +21,6 @@ template class SerializationHelper<AdjList<GraphDirectionality::undirected>>;
 template class SerializationHelper<AdjList<GraphDirectionality::directed>>;
 template class SerializationHelper<AdjMatrix<GraphDirectionality::undirected>>;
 template class SerializationHelper<AdjMatrix<GraphDirectionality::directed>>;
+template class SerializationHelper<AdjBitMatrix<GraphDirectionality::undirected>>;
+template class SerializationHelper<AdjBitMatrix<GraphDirectionality::directed>>;
 } // namespace Graphs
@@ -0,0 +1,128 @@
+#include <gmock/gmock.h>
+#include <Graphs/AdjBitMatrix.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace
+{
+constexpr uint32_t fiveNodes = 5;
+constexpr uint32_t nodesSpanningSeveralWords = 200;
+
+constexpr Graphs::NodeId firstNodeId = 1;
+constexpr Graphs::NodeId secondNodeId = 2;
+constexpr Graphs::NodeId thirdNodeId = 3;
+constexpr Graphs::NodeId fourthNodeId = 4;
+constexpr Graphs::NodeId fifthNodeId = 5;
+} // namespace
+
+namespace Graphs
+{
+template <typename GraphType>
+class AdjBitMatrixTests : public testing::Test
+{
+protected:
+    GraphType sut;
+};
+
+using AdjBitMatrixTypes
+    = ::testing::Types<AdjBitMatrix<GraphDirectionality::undirected>, AdjBitMatrix<GraphDirectionality::directed>>;
+
+TYPED_TEST_SUITE(AdjBitMatrixTests, AdjBitMatrixTypes);
+
+TYPED_TEST(AdjBitMatrixTests, commonNeighborsAreTheIntersectionOfOutgoingNeighborhoods)
+{
+    this->sut.addNodes(fiveNodes);
+    this->sut.setEdges({
+        {firstNodeId,   thirdNodeId},
+        {firstNodeId,  fourthNodeId},
+        {firstNodeId,   fifthNodeId},
+        {secondNodeId, fourthNodeId},
+        {secondNodeId,  fifthNodeId}
+    });
+
+    EXPECT_THAT(this->sut.getCommonNeighborsOf(firstNodeId, secondNodeId), ElementsAre(fourthNodeId, fifthNodeId));
+    EXPECT_EQ(this->sut.countCommonNeighbors(firstNodeId, secondNodeId), 2);
+}
+
+TYPED_TEST(AdjBitMatrixTests, neighborhoodUnionContainsNeighborsOfBothNodes)
+{
+    this->sut.addNodes(fiveNodes);
+    this->sut.setEdges({
+        {firstNodeId,   thirdNodeId},
+        {secondNodeId, fourthNodeId},
+        {secondNodeId,  fifthNodeId}
+    });
+
+    EXPECT_THAT(this->sut.getNeighborhoodUnionOf(firstNodeId, secondNodeId),
+                ElementsAre(thirdNodeId, fourthNodeId, fifthNodeId));
+}
+
+TYPED_TEST(AdjBitMatrixTests, neighborOperationsOnNonexistantNodesReturnEmptyResults)
+{
+    this->sut.addNodes(fiveNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId});
+
+    EXPECT_TRUE(this->sut.getCommonNeighborsOf(firstNodeId, fiveNodes + 1).empty());
+    EXPECT_EQ(this->sut.countCommonNeighbors(fiveNodes + 1, firstNodeId), 0);
+    EXPECT_THAT(this->sut.getNeighborhoodUnionOf(fiveNodes + 1, firstNodeId), ElementsAre(thirdNodeId));
+}
+
+TYPED_TEST(AdjBitMatrixTests, neighborOperationsWorkAcrossWordBoundaries)
+{
+    this->sut.addNodes(nodesSpanningSeveralWords);
+    std::vector<NodeId> expected = {};
+    for (NodeId node = 3; node <= nodesSpanningSeveralWords; node += 7)
+    {
+        this->sut.setEdge({firstNodeId, node});
+        this->sut.setEdge({secondNodeId, node});
+        expected.push_back(node);
+    }
+
+    EXPECT_THAT(this->sut.getCommonNeighborsOf(firstNodeId, secondNodeId), ElementsAreArray(expected));
+    EXPECT_EQ(this->sut.countCommonNeighbors(firstNodeId, secondNodeId), expected.size());
+    EXPECT_EQ(this->sut.getOutgoingDegree(firstNodeId), expected.size());
+}
+
+TYPED_TEST(AdjBitMatrixTests, removingNodeShiftsFollowingColumnsAcrossWordBoundaries)
+{
+    this->sut.addNodes(nodesSpanningSeveralWords);
+    this->sut.setEdges({
+        {firstNodeId,  63},
+        {firstNodeId,  64},
+        {firstNodeId,  65},
+        {firstNodeId, 129, 7}
+    });
+
+    this->sut.removeNode(10);
+
+    EXPECT_THAT(this->sut.getOutgoingNeighborsOf(firstNodeId), ElementsAre(63, 64, 65, 129));
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, 129}).weight, 7);
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, 10}).weight, std::nullopt);
+    EXPECT_EQ(this->sut.getIncommingDegree(64), 1);
+}
+
+TYPED_TEST(AdjBitMatrixTests, addingNodesPreservesExistingEdgesAndWeights)
+{
+    this->sut.addNodes(fiveNodes);
+    this->sut.setEdge({secondNodeId, fourthNodeId, 3});
+
+    this->sut.addNodes(nodesSpanningSeveralWords);
+    this->sut.setEdge({fourthNodeId, nodesSpanningSeveralWords});
+
+    EXPECT_EQ(this->sut.findEdge({secondNodeId, fourthNodeId}).weight, 3);
+    EXPECT_EQ(this->sut.findEdge({fourthNodeId, nodesSpanningSeveralWords}).weight, 1);
+    EXPECT_EQ(this->sut.getEdges().size(), TypeParam::Directionality == GraphDirectionality::directed ? 2 : 4);
+}
+
+TYPED_TEST(AdjBitMatrixTests, resettingWeightToDefaultKeepsTheEdge)
+{
+    this->sut.addNodes(fiveNodes);
+    this->sut.setEdge({firstNodeId, secondNodeId, 5});
+    this->sut.setEdge({firstNodeId, secondNodeId, 1});
+
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, secondNodeId}).weight, 1);
+    this->sut.removeEdge({firstNodeId, secondNodeId});
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, secondNodeId}).weight, std::nullopt);
+}
+} // namespace Graphs
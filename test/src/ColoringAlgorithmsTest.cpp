@@ -2,6 +2,7 @@
 #include <GraphRepresentationHelpers.hpp>
 #include <Graphs/Algorithm.hpp>
 #include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/Orderings.hpp>
 #include <gtest/gtest.h>
 
 using namespace testing;
@@ -142,12 +143,12 @@ struct GreedyColoringTests : public ColoringTests<GraphType>
 
 TYPED_TEST_SUITE(GreedyColoringTests, GraphTypes);
 
-TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber3Returns3)
+TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber3UsesColorsUpTo2)
 {
     auto sampleGraph = this->createGraphWithChromaticNumber3();
     this->sut->operator()(sampleGraph);
     auto& [coloringValue, _] = *this->result;
-    EXPECT_EQ(coloringValue, 3);
+    EXPECT_EQ(coloringValue, 2);
 }
 
 TYPED_TEST(GreedyColoringTests, greedyColoringOnEmptyGraphReturnsMinColor)
@@ -166,27 +167,378 @@ TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithOneNodeReturnsMinimalCo
     EXPECT_EQ(coloringValue, std::numeric_limits<ColorId>::min());
 }
 
-TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber4Returns4)
+TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber4UsesColorsUpTo3)
 {
     auto sampleGraph = this->createGraphWithChromaticNumber4();
     this->sut->operator()(sampleGraph);
     auto& [coloringValue, _] = *this->result;
-    EXPECT_EQ(coloringValue, 4);
+    EXPECT_EQ(coloringValue, 3);
 }
 
-TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber5Returns5)
+TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber5UsesColorsUpTo5)
 {
     auto sampleGraph = this->createGraphWithChromaticNumber5();
     this->sut->operator()(sampleGraph);
     auto& [coloringValue, _] = *this->result;
+    // Node 1 together with nodes 4 to 8 forms a clique of six, so six colors are needed after all.
     EXPECT_EQ(coloringValue, 5);
 }
 
-TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber6Returns6)
+TYPED_TEST(GreedyColoringTests, greedyColoringOnGraphWithChromaticNumber6UsesColorsUpTo5)
 {
     auto sampleGraph = this->createGraphWithChromaticNumber6();
     this->sut->operator()(sampleGraph);
     auto& [coloringValue, _] = *this->result;
-    EXPECT_EQ(coloringValue, 6);
+    EXPECT_EQ(coloringValue, 5);
+}
+
+template <typename GraphType>
+struct ColoringValidityTests : public ColoringTests<GraphType>
+{
+    template <typename Algorithm>
+    void expectProperColoringOf(const GraphType& graph)
+    {
+        auto result = std::make_shared<ColoringResult>();
+        Algorithm{result}(graph);
+        auto& [maxColor, coloring] = *result;
+
+        ASSERT_EQ(coloring.size(), graph.nodesAmount());
+        std::vector<ColorId> colors(graph.nodesAmount() + 1);
+        for (auto& [nodeId, color] : coloring)
+        {
+            EXPECT_LE(color, maxColor);
+            colors[nodeId] = color;
+        }
+        for (const auto& edge : graph.getEdges())
+        {
+            EXPECT_NE(colors[edge.source], colors[edge.destination]);
+        }
+    }
+};
+
+TYPED_TEST_SUITE(ColoringValidityTests, GraphTypes);
+
+TYPED_TEST(ColoringValidityTests, allColoringAlgorithmsProduceProperColoringsOfEveryNode)
+{
+    for (const auto& graph : {this->createGraphWithChromaticNumber3(),
+                              this->createGraphWithChromaticNumber4(),
+                              this->createGraphWithChromaticNumber5()})
+    {
+        this->template expectProperColoringOf<GreedyColoring<notVerbose>>(graph);
+        this->template expectProperColoringOf<LfColoring<notVerbose>>(graph);
+        this->template expectProperColoringOf<SlColoring<notVerbose>>(graph);
+        this->template expectProperColoringOf<ParallelColoring<notVerbose>>(graph);
+        this->template expectProperColoringOf<DSaturColoring<notVerbose>>(graph);
+    }
+}
+
+template <typename GraphType>
+struct DSaturColoringTests : public ColoringTests<GraphType>
+{
+    ColoringResult colorWithDSatur(const GraphType& graph)
+    {
+        auto result = std::make_shared<ColoringResult>();
+        DSaturColoring<notVerbose>{result}(graph);
+        return *result;
+    }
+};
+
+TYPED_TEST_SUITE(DSaturColoringTests, GraphTypes);
+
+TYPED_TEST(DSaturColoringTests, dsaturColoringOnEmptyGraphLeavesResultUntouched)
+{
+    auto [coloringValue, coloring] = this->colorWithDSatur(this->createEmptyGraph());
+    EXPECT_EQ(coloringValue, std::numeric_limits<ColorId>::min());
+    EXPECT_TRUE(coloring.empty());
+}
+
+TYPED_TEST(DSaturColoringTests, dsaturColoringOfCliqueUsesAsManyColorsAsNodes)
+{
+    auto [coloringValue, coloring] = this->colorWithDSatur(this->createGraphWithChromaticNumber6());
+    EXPECT_EQ(coloringValue, 5);
+    EXPECT_EQ(coloring.size(), 6);
+}
+
+TYPED_TEST(DSaturColoringTests, dsaturColoringStartsFromNodeOfHighestDegree)
+{
+    auto graph = this->createGraphWithChromaticNumber4();
+    auto [_, coloring] = this->colorWithDSatur(graph);
+
+    ASSERT_FALSE(coloring.empty());
+    EXPECT_THAT(coloring.front(), Pair(largestFirstOrdering(graph).front(), 0));
+}
+
+TYPED_TEST(DSaturColoringTests, dsaturColoringOfBipartiteGraphUsesTwoColors)
+{
+    constexpr uint32_t sideSize = 6;
+    TypeParam graph = {};
+    graph.addNodes(sideSize * 2);
+    for (NodeId left = 1; left <= sideSize; left++)
+    {
+        for (NodeId right = sideSize + 1; right <= sideSize * 2; right++)
+        {
+            if (left + sideSize != right)
+            {
+                graph.setEdge({left, right});
+                graph.setEdge({right, left});
+            }
+        }
+    }
+
+    auto [coloringValue, _] = this->colorWithDSatur(graph);
+    EXPECT_EQ(coloringValue, 1);
+}
+
+template <typename GraphType>
+struct ParallelColoringTests : public ColoringTests<GraphType>
+{
+    ColoringResult colorWith(const GraphType& graph, uint32_t threadsCount, uint64_t seed = 0)
+    {
+        auto result = std::make_shared<ColoringResult>();
+        ParallelColoring<notVerbose>{result, std::cout, threadsCount, seed}(graph);
+        return *result;
+    }
+
+    GraphType createLargeRandomGraph()
+    {
+        return makeRandomGraph<GraphType>(2000, 2000 * 4, 7);
+    }
+};
+
+TYPED_TEST_SUITE(ParallelColoringTests, GraphTypes);
+
+TYPED_TEST(ParallelColoringTests, parallelColoringOnEmptyGraphLeavesResultUntouched)
+{
+    auto [coloringValue, coloring] = this->colorWith(this->createEmptyGraph(), 4);
+    EXPECT_EQ(coloringValue, std::numeric_limits<ColorId>::min());
+    EXPECT_TRUE(coloring.empty());
+}
+
+TYPED_TEST(ParallelColoringTests, parallelColoringOfCliqueUsesAsManyColorsAsNodes)
+{
+    auto [coloringValue, _] = this->colorWith(this->createGraphWithChromaticNumber6(), 4);
+    EXPECT_EQ(coloringValue, 5);
+}
+
+TYPED_TEST(ParallelColoringTests, parallelColoringDoesNotDependOnThreadsCount)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto singleThreaded = this->colorWith(graph, 1, 3);
+    auto multiThreaded = this->colorWith(graph, 8, 3);
+
+    EXPECT_EQ(singleThreaded, multiThreaded);
+    auto& [maxColor, _] = multiThreaded;
+    EXPECT_LE(maxColor, graph.graphDegree() * 2);
+}
+
+TYPED_TEST(ParallelColoringTests, parallelColoringOfLargeGraphIsProper)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto [_, coloring] = this->colorWith(graph, 8);
+
+    std::vector<ColorId> colors(graph.nodesAmount() + 1);
+    for (auto& [nodeId, color] : coloring)
+    {
+        colors[nodeId] = color;
+    }
+    for (const auto& edge : graph.getEdges())
+    {
+        if (edge.source != edge.destination)
+        {
+            EXPECT_NE(colors[edge.source], colors[edge.destination]);
+        }
+    }
+}
+
+template <typename GraphType>
+struct SpeculativeColoringTests : public ParallelColoringTests<GraphType>
+{
+    ColoringResult colorWith(const GraphType& graph, NodeOrdering ordering, uint32_t threadsCount)
+    {
+        auto result = std::make_shared<ColoringResult>();
+        SpeculativeColoring<notVerbose>{result, std::cout, ordering, threadsCount}(graph);
+        return *result;
+    }
+};
+
+TYPED_TEST_SUITE(SpeculativeColoringTests, GraphTypes);
+
+TYPED_TEST(SpeculativeColoringTests, speculativeColoringIsProperForEveryOrdering)
+{
+    auto graph = this->createLargeRandomGraph();
+    for (auto ordering : {NodeOrdering::natural, NodeOrdering::largestFirst, NodeOrdering::smallestLast})
+    {
+        auto [maxColor, coloring] = this->colorWith(graph, ordering, 8);
+
+        ASSERT_EQ(coloring.size(), graph.nodesAmount());
+        std::vector<ColorId> colors(graph.nodesAmount() + 1);
+        for (auto& [nodeId, color] : coloring)
+        {
+            EXPECT_LE(color, maxColor);
+            colors[nodeId] = color;
+        }
+        for (const auto& edge : graph.getEdges())
+        {
+            if (edge.source != edge.destination)
+            {
+                EXPECT_NE(colors[edge.source], colors[edge.destination]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SpeculativeColoringTests, speculativeColoringFollowsTheRequestedOrdering)
+{
+    auto graph = this->createGraphWithChromaticNumber4();
+    auto [_, coloring] = this->colorWith(graph, NodeOrdering::largestFirst, 2);
+
+    ASSERT_FALSE(coloring.empty());
+    EXPECT_EQ(coloring.front().first, largestFirstOrdering(graph).front());
+}
+
+TYPED_TEST(SpeculativeColoringTests, singleThreadedSpeculativeColoringIsSequentialFirstFit)
+{
+    auto [maxColor, coloring] = this->colorWith(this->createGraphWithChromaticNumber3(), NodeOrdering::natural, 1);
+
+    EXPECT_EQ(maxColor, 2);
+    EXPECT_THAT(coloring.front(), Pair(1, 0));
+    EXPECT_THAT(coloring.back(), Pair(10, 2));
+}
+
+template <typename GraphType>
+struct ChromaticNumberTests : public ParallelColoringTests<GraphType>
+{
+    ChromaticNumberResult solve(const GraphType& graph, SearchBudget budget = {}, uint32_t threadsCount = 4)
+    {
+        auto result = std::make_shared<ChromaticNumberResult>();
+        ChromaticNumber<notVerbose>{result, std::cout, budget, threadsCount}(graph);
+        return *result;
+    }
+
+    // Mycielski graph of the five-cycle: triangle free, yet it needs four colors.
+    GraphType createGroetzschGraph()
+    {
+        constexpr uint32_t cycleLength = 5;
+        constexpr NodeId apexId = cycleLength * 2 + 1;
+        GraphType graph = {};
+        graph.addNodes(apexId);
+        auto connect = [&graph](NodeId source, NodeId destination) {
+            graph.setEdge({source, destination});
+            graph.setEdge({destination, source});
+        };
+        for (NodeId node = 1; node <= cycleLength; node++)
+        {
+            auto next = node % cycleLength + 1;
+            connect(node, next);
+            connect(node + cycleLength, next);
+            connect(next + cycleLength, node);
+            connect(node + cycleLength, apexId);
+        }
+        return graph;
+    }
+
+    void expectProperColoring(const GraphType& graph, const ColoringVector& coloring, uint32_t colorsCount)
+    {
+        ASSERT_EQ(coloring.size(), graph.nodesAmount());
+        std::vector<ColorId> colors(graph.nodesAmount() + 1);
+        for (auto& [nodeId, color] : coloring)
+        {
+            EXPECT_LT(color, colorsCount);
+            colors[nodeId] = color;
+        }
+        for (const auto& edge : graph.getEdges())
+        {
+            if (edge.source != edge.destination)
+            {
+                EXPECT_NE(colors[edge.source], colors[edge.destination]);
+            }
+        }
+    }
+
+    void expectChromaticNumber(const GraphType& graph, uint32_t chromaticNumber)
+    {
+        auto [lowerBound, colorsCount, coloring] = solve(graph);
+        EXPECT_EQ(lowerBound, chromaticNumber);
+        EXPECT_EQ(colorsCount, chromaticNumber);
+        expectProperColoring(graph, coloring, colorsCount);
+    }
+};
+
+TYPED_TEST_SUITE(ChromaticNumberTests, GraphTypes);
+
+TYPED_TEST(ChromaticNumberTests, chromaticNumberOfEmptyGraphLeavesResultUntouched)
+{
+    auto [lowerBound, colorsCount, coloring] = this->solve(this->createEmptyGraph());
+    EXPECT_EQ(lowerBound, 0);
+    EXPECT_EQ(colorsCount, 0);
+    EXPECT_TRUE(coloring.empty());
+}
+
+TYPED_TEST(ChromaticNumberTests, chromaticNumbersOfSampleGraphsAreProvenOptimal)
+{
+    this->expectChromaticNumber(this->createGraphWithOnlyOneNode(), 1);
+    this->expectChromaticNumber(this->createGraphWithChromaticNumber3(), 3);
+    this->expectChromaticNumber(this->createGraphWithChromaticNumber4(), 4);
+    // Each of the nodes 1 to 3 completes the 5-clique of the remaining ones to a 6-clique.
+    this->expectChromaticNumber(this->createGraphWithChromaticNumber5(), 6);
+    this->expectChromaticNumber(this->createGraphWithChromaticNumber6(), 6);
+}
+
+TYPED_TEST(ChromaticNumberTests, searchProvesOptimalityAboveCliqueBound)
+{
+    auto graph = this->createGroetzschGraph();
+    for (uint32_t threadsCount : {1u, 8u})
+    {
+        auto [lowerBound, colorsCount, coloring] = this->solve(graph, {}, threadsCount);
+        EXPECT_EQ(lowerBound, 4);
+        EXPECT_EQ(colorsCount, 4);
+        this->expectProperColoring(graph, coloring, colorsCount);
+    }
+}
+
+TYPED_TEST(ChromaticNumberTests, exhaustedBudgetReturnsHeuristicColoringWithCliqueBound)
+{
+    auto graph = this->createGroetzschGraph();
+    auto [lowerBound, colorsCount, coloring] = this->solve(graph, {.maxBranches = 0}, 1);
+
+    EXPECT_EQ(lowerBound, 2);
+    EXPECT_GE(colorsCount, 4);
+    this->expectProperColoring(graph, coloring, colorsCount);
+}
+
+TYPED_TEST(ChromaticNumberTests, boundsOfLargeGraphStayConsistentWithinBudget)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto [lowerBound, colorsCount, coloring] = this->solve(graph, {.maxBranches = 20000}, 8);
+
+    EXPECT_GE(lowerBound, 2);
+    EXPECT_LE(lowerBound, colorsCount);
+    this->expectProperColoring(graph, coloring, colorsCount);
+}
+
+TEST(ChromaticNumberOfLargeGraphTests, cliqueBoundIsFoundWithoutAdjacencyBitsetsOnLargeGraphs)
+{
+    constexpr uint32_t nodesCount = 10000;
+    constexpr NodeId cliqueSize = 5;
+    AdjList<GraphDirectionality::undirected> graph = {};
+    graph.addNodes(nodesCount);
+    for (NodeId source = 1; source <= cliqueSize; source++)
+    {
+        for (NodeId destination = source + 1; destination <= cliqueSize; destination++)
+        {
+            graph.setEdge({source, destination});
+        }
+    }
+    for (NodeId node = cliqueSize + 1; node < nodesCount; node++)
+    {
+        graph.setEdge({node, node + 1});
+    }
+
+    auto result = std::make_shared<ChromaticNumberResult>();
+    ChromaticNumber<notVerbose>{result, std::cout, {.maxBranches = 0}, 1}(graph);
+    auto& [lowerBound, colorsCount, coloring] = *result;
+    EXPECT_EQ(lowerBound, cliqueSize);
+    EXPECT_EQ(colorsCount, cliqueSize);
+    EXPECT_EQ(coloring.size(), nodesCount);
 }
 } // namespace Graphs
@@ -0,0 +1,200 @@
+#include <gmock/gmock.h>
+#include <GraphRepresentationHelpers.hpp>
+#include <Graphs/ColoringAlgorithms.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/Deserializer.hpp>
+#include <gtest/gtest.h>
+#include <SerializationHelpers.hpp>
+#include <sstream>
+
+using namespace testing;
+
+namespace
+{
+constexpr uint32_t fourNodes = 4;
+
+constexpr Graphs::NodeId firstNodeId = 1;
+constexpr Graphs::NodeId secondNodeId = 2;
+constexpr Graphs::NodeId thirdNodeId = 3;
+constexpr Graphs::NodeId fourthNodeId = 4;
+} // namespace
+
+namespace Graphs
+{
+template <typename GraphType>
+class CsrGraphTests : public testing::Test
+{
+protected:
+    using SourceGraph = AdjList<GraphType::Directionality>;
+
+    SourceGraph createSourceGraph()
+    {
+        SourceGraph graph = {};
+        graph.addNodes(fourNodes);
+        graph.setEdges({
+            {firstNodeId,  thirdNodeId, 5},
+            {secondNodeId, firstNodeId},
+            {thirdNodeId, fourthNodeId, 2}
+        });
+        return graph;
+    }
+};
+
+TYPED_TEST_SUITE(CsrGraphTests, CsrGraphTypes);
+
+TYPED_TEST(CsrGraphTests, defaultConstructorCreatesAnEmptyGraph)
+{
+    TypeParam sut = {};
+    EXPECT_EQ(sut.nodesAmount(), 0);
+    EXPECT_EQ(sut.graphDegree(), 0);
+    EXPECT_TRUE(sut.getEdges().empty());
+}
+
+TYPED_TEST(CsrGraphTests, graphBuiltFromAnotherRepresentationIsEqualToIt)
+{
+    auto source = this->createSourceGraph();
+    TypeParam sut(source);
+
+    EXPECT_EQ(sut.nodesAmount(), source.nodesAmount());
+    EXPECT_EQ(sut, source);
+    EXPECT_EQ(sut.findEdge({firstNodeId, thirdNodeId}).weight, 5);
+    EXPECT_EQ(sut.findEdge({thirdNodeId, fourthNodeId}).weight, 2);
+}
+
+TYPED_TEST(CsrGraphTests, graphBuiltFromRepresentationWithRemovedNodeKeepsOriginalIds)
+{
+    auto source = this->createSourceGraph();
+    source.removeNode(secondNodeId);
+    TypeParam sut(source);
+
+    EXPECT_THAT(sut.getNodeIds(), ElementsAre(firstNodeId, thirdNodeId, fourthNodeId));
+    EXPECT_EQ(sut.findEdge({firstNodeId, thirdNodeId}).weight, 5);
+    EXPECT_EQ(sut.findEdge({secondNodeId, firstNodeId}).weight, std::nullopt);
+}
+
+TYPED_TEST(CsrGraphTests, graphBuiltFromEdgeListReturnsCorrectNeighbors)
+{
+    std::vector<EdgeInfo> edges = {{firstNodeId, thirdNodeId}, {secondNodeId, firstNodeId}};
+    TypeParam sut(fourNodes, edges);
+
+    EXPECT_THAT(sut.getNeighborsOf(firstNodeId), ElementsAre(secondNodeId, thirdNodeId));
+    if constexpr (TypeParam::Directionality == GraphDirectionality::directed)
+    {
+        EXPECT_THAT(sut.getOutgoingNeighborsOf(firstNodeId), ElementsAre(thirdNodeId));
+        EXPECT_THAT(sut.getIncommingNeighborsOf(firstNodeId), ElementsAre(secondNodeId));
+        EXPECT_EQ(sut.getOutgoingDegree(thirdNodeId), 0);
+    }
+    else
+    {
+        EXPECT_THAT(sut.getOutgoingNeighborsOf(firstNodeId), ElementsAre(secondNodeId, thirdNodeId));
+        EXPECT_THAT(sut.getIncommingNeighborsOf(firstNodeId), ElementsAre(secondNodeId, thirdNodeId));
+        EXPECT_EQ(sut.getOutgoingDegree(thirdNodeId), 1);
+    }
+}
+
+TYPED_TEST(CsrGraphTests, forEachNeighborVisitsSortedUnionOfNeighbors)
+{
+    std::vector<EdgeInfo> edges = {
+        {firstNodeId,  thirdNodeId},
+        {thirdNodeId,  firstNodeId},
+        {secondNodeId, firstNodeId}
+    };
+    TypeParam sut(fourNodes, edges);
+
+    std::vector<NodeId> visited = {};
+    sut.forEachNeighbor(firstNodeId, [&visited](NodeId node) {
+        visited.push_back(node);
+    });
+    EXPECT_THAT(visited, ElementsAre(secondNodeId, thirdNodeId));
+}
+
+TYPED_TEST(CsrGraphTests, forEachOutgoingEdgeVisitsNeighborsWithTheirWeights)
+{
+    std::vector<EdgeInfo> edges = {
+        {firstNodeId,  thirdNodeId, 4},
+        {firstNodeId, secondNodeId}
+    };
+    TypeParam sut(fourNodes, edges);
+
+    std::vector<std::pair<NodeId, WeightType>> visited = {};
+    sut.forEachOutgoingEdge(firstNodeId, [&visited](NodeId node, WeightType weight) {
+        visited.emplace_back(node, weight);
+    });
+    EXPECT_THAT(visited, ElementsAre(Pair(secondNodeId, 1), Pair(thirdNodeId, 4)));
+}
+
+TYPED_TEST(CsrGraphTests, neighborViewsReferToTheStoredRows)
+{
+    auto source = this->createSourceGraph();
+    TypeParam sut(source);
+
+    EXPECT_THAT(sut.getOutgoingNeighborsView(firstNodeId), ElementsAreArray(sut.getOutgoingNeighborsOf(firstNodeId)));
+    EXPECT_THAT(sut.getIncommingNeighborsView(firstNodeId), ElementsAreArray(sut.getIncommingNeighborsOf(firstNodeId)));
+    EXPECT_TRUE(sut.getOutgoingNeighborsView(fourNodes + 1).empty());
+}
+
+TYPED_TEST(CsrGraphTests, repeatedEdgesInEdgeListKeepTheLastWeight)
+{
+    std::vector<EdgeInfo> edges = {{firstNodeId, thirdNodeId, 5}, {firstNodeId, thirdNodeId, 10}};
+    TypeParam sut(fourNodes, edges);
+
+    EXPECT_EQ(sut.getOutgoingDegree(firstNodeId), 1);
+    EXPECT_EQ(sut.findEdge({firstNodeId, thirdNodeId}).weight, 10);
+}
+
+TYPED_TEST(CsrGraphTests, edgesBetweenNonexistantNodesAreIgnored)
+{
+    std::vector<EdgeInfo> edges = {{firstNodeId, thirdNodeId}, {firstNodeId, secondNodeId}};
+    TypeParam sut(secondNodeId, edges);
+
+    EXPECT_EQ(sut.getOutgoingDegree(firstNodeId), 1);
+    EXPECT_EQ(sut.findEdge({firstNodeId, thirdNodeId}).weight, std::nullopt);
+}
+
+TYPED_TEST(CsrGraphTests, graphDegreeIsComputedOnConstruction)
+{
+    std::vector<EdgeInfo> edges = {
+        {firstNodeId, secondNodeId},
+        {firstNodeId,  thirdNodeId},
+        {firstNodeId, fourthNodeId}
+    };
+    TypeParam sut(fourNodes, edges);
+
+    EXPECT_EQ(sut.graphDegree(), 3);
+}
+
+TYPED_TEST(CsrGraphTests, canDeserializeMatFile)
+{
+    SerializationHelper<typename TestFixture::SourceGraph> helper;
+    auto [fileContent, referenceGraph] = helper.makeSampleMatFile();
+    std::stringstream mockStream(fileContent);
+
+    auto graph = Deserializer<TypeParam>::deserializeMatFile(mockStream);
+
+    EXPECT_EQ(graph, referenceGraph);
+}
+
+TYPED_TEST(CsrGraphTests, canDeserializeLstFile)
+{
+    SerializationHelper<typename TestFixture::SourceGraph> helper;
+    auto [fileContent, referenceGraph] = helper.makeSampleLstFile();
+    std::stringstream mockStream(fileContent);
+
+    auto graph = Deserializer<TypeParam>::deserializeLstFile(mockStream);
+
+    EXPECT_EQ(graph, referenceGraph);
+}
+
+TYPED_TEST(CsrGraphTests, coloringResultIsTheSameAsForSourceRepresentation)
+{
+    auto source = this->createSourceGraph();
+    TypeParam sut(source);
+
+    auto expected = std::make_shared<Algorithm::ColoringResult>();
+    auto actual = std::make_shared<Algorithm::ColoringResult>();
+    Algorithm::GreedyColoring<Algorithm::notVerbose>{expected}(source);
+    Algorithm::GreedyColoring<Algorithm::notVerbose>{actual}(sut);
+
+    EXPECT_EQ(*actual, *expected);
+}
+} // namespace Graphs
@@ -0,0 +1,72 @@
+#include <Graphs/DegreeTable.hpp>
+#include <gtest/gtest.h>
+
+namespace Graphs
+{
+class DegreeTableTests : public testing::Test
+{
+protected:
+    DegreeTable sut;
+};
+
+TEST_F(DegreeTableTests, addedNodesHaveNoEdges)
+{
+    this->sut.addNodes(3);
+    EXPECT_EQ(this->sut.outgoingDegreeOf(2), 0);
+    EXPECT_EQ(this->sut.incommingDegreeOf(2), 0);
+    EXPECT_EQ(this->sut.maxDegree(), 0);
+}
+
+TEST_F(DegreeTableTests, degreeOfNodeIsTheLargerOfItsCounters)
+{
+    this->sut.addNodes(3);
+    this->sut.edgeAdded(0, 1);
+    this->sut.edgeAdded(0, 2);
+    this->sut.edgeAdded(1, 0);
+
+    EXPECT_EQ(this->sut.outgoingDegreeOf(0), 2);
+    EXPECT_EQ(this->sut.incommingDegreeOf(0), 1);
+    EXPECT_EQ(this->sut.degreeOf(0), 2);
+    EXPECT_EQ(this->sut.degreeOf(1), 1);
+    EXPECT_EQ(this->sut.maxDegree(), 2);
+}
+
+TEST_F(DegreeTableTests, maxDegreeDecreasesWhenLastNodeWithItLosesAnEdge)
+{
+    this->sut.addNodes(3);
+    this->sut.edgeAdded(0, 1);
+    this->sut.edgeAdded(0, 2);
+    this->sut.edgeAdded(1, 2);
+    EXPECT_EQ(this->sut.maxDegree(), 2);
+
+    this->sut.edgeRemoved(0, 2);
+    EXPECT_EQ(this->sut.maxDegree(), 1);
+}
+
+TEST_F(DegreeTableTests, removingNodeShiftsFollowingCountersAndUpdatesMaxDegree)
+{
+    this->sut.addNodes(3);
+    this->sut.edgeAdded(1, 0);
+    this->sut.edgeAdded(1, 2);
+    this->sut.edgeAdded(2, 0);
+
+    this->sut.edgeRemoved(1, 0);
+    this->sut.edgeRemoved(1, 2);
+    this->sut.removeNode(1);
+
+    EXPECT_EQ(this->sut.outgoingDegreeOf(1), 1);
+    EXPECT_EQ(this->sut.incommingDegreeOf(0), 1);
+    EXPECT_EQ(this->sut.maxDegree(), 1);
+}
+
+TEST_F(DegreeTableTests, clearedTableHasNoDegree)
+{
+    this->sut.addNodes(2);
+    this->sut.edgeAdded(0, 1);
+    this->sut.clear();
+    EXPECT_EQ(this->sut.maxDegree(), 0);
+
+    this->sut.addNodes(1);
+    EXPECT_EQ(this->sut.degreeOf(0), 0);
+}
+} // namespace Graphs
@@ -1,7 +1,13 @@
+#include <algorithm>
+#include <filesystem>
 #include <gmock/gmock.h>
 #include <GraphRepresentationHelpers.hpp>
 #include <Graphs/Deserializer.hpp>
+#include <Graphs/SerializationFormats.hpp>
+#include <Graphs/Serializer.hpp>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <random>
 #include <SerializationHelpers.hpp>
 
 using namespace testing;
@@ -20,6 +26,24 @@ struct DeserializerTest : public testing::Test
                "0 2 3\n";
     }
 
+    // Rows of its files are long enough to cross the boundaries of the read window.
+    GraphType createLargeRandomGraph()
+    {
+        return makeRandomGraph<GraphType>(300, 300 * 10, 13, {{1, 99}});
+    }
+
+    ~DeserializerTest() override
+    {
+        std::filesystem::remove(temporaryFile);
+    }
+
+    const std::filesystem::path& writeTemporaryFile(const std::string& content)
+    {
+        std::ofstream(temporaryFile, std::ios::binary) << content;
+        return temporaryFile;
+    }
+
+    std::filesystem::path temporaryFile = std::filesystem::temp_directory_path() / "GraphCakeDeserializerTest.tmp";
     SerializationHelper<GraphType> helper;
 
     using sut = Deserializer<GraphType>;
@@ -57,6 +81,19 @@ TYPED_TEST(DeserializerTest, canDeserializeGraphMlFile)
     EXPECT_EQ(graph, referenceGraph);
 }
 
+TYPED_TEST(DeserializerTest, graphMlEdgesWithoutDataTakeTheDeclaredDefaultWeight)
+{
+    auto [fileContent, referenceGraph] = this->helper.makeSampleGraphMlFile();
+    fileContent.replace(fileContent.find("<default>1</default>"), 20, "<default>7</default>");
+    std::stringstream mockStream(fileContent);
+
+    auto graph = DeserializerTest<TypeParam>::sut::deserializeGraphMlFile(mockStream);
+
+    EXPECT_EQ(graph.findEdge({.source = 1, .destination = 2}).weight, 7);
+    EXPECT_EQ(graph.findEdge({.source = 2, .destination = 1}).weight, 7);
+    EXPECT_EQ(graph.findEdge({.source = 3, .destination = 4}).weight, 5);
+}
+
 TYPED_TEST(DeserializerTest, deserializingEmptyLstFileReturnsEmptyGraph)
 {
     auto [fileContent, referenceGraph] = this->helper.makeSampleEmptyFile();
@@ -166,4 +203,286 @@ TYPED_TEST(DeserializerTest, deserializingGraphMlFileWithissmatchedDirectionalit
 
     EXPECT_EQ(graph, referenceGraph);
 }
+
+TYPED_TEST(DeserializerTest, lastLineWithoutNewlineIsParsed)
+{
+    auto [fileContent, referenceGraph] = this->helper.makeSampleMatFile();
+    std::stringstream matStream(fileContent.substr(0, fileContent.size() - 1));
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeMatFile(matStream), referenceGraph);
+
+    auto [lstContent, lstReferenceGraph] = this->helper.makeSampleLstFile();
+    std::stringstream lstStream(lstContent.substr(0, lstContent.size() - 1));
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeLstFile(lstStream), lstReferenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, carriageReturnsAndBlankLinesAreSkipped)
+{
+    auto [fileContent, referenceGraph] = this->helper.makeSampleMatFile();
+    std::stringstream mockStream("\r\n1 2 3\r\n  \n2 1 0\r\n3\t0 3\r\n\n");
+
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeMatFile(mockStream), referenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, lstLinesWithoutNeighborsKeepTheirNodes)
+{
+    std::stringstream mockStream("1: 2\n2:\n3:\n4: 1");
+    auto graph = DeserializerTest<TypeParam>::sut::deserializeLstFile(mockStream);
+
+    TypeParam referenceGraph = {};
+    referenceGraph.addNodes(4);
+    referenceGraph.setEdges({
+        {.source = 1, .destination = 2},
+        {.source = 4, .destination = 1}
+    });
+    EXPECT_EQ(graph, referenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, matFileWithNegativeWeightsIsParsed)
+{
+    std::stringstream mockStream("0 -4\n-4 0\n");
+    auto graph = DeserializerTest<TypeParam>::sut::deserializeMatFile(mockStream);
+
+    TypeParam referenceGraph = {};
+    referenceGraph.addNodes(2);
+    referenceGraph.setEdges({
+        {.source = 1, .destination = 2, .weight = -4},
+        {.source = 2, .destination = 1, .weight = -4}
+    });
+    EXPECT_EQ(graph, referenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, invalidTokensReturnEmptyGraph)
+{
+    for (std::string fileContent : {"1 0\n0 x\n", "1 0\n0 1.5\n"})
+    {
+        std::stringstream mockStream(fileContent);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeMatFile(mockStream), TypeParam{});
+    }
+    for (std::string fileContent : {"1: 2\n2 1\n", "1: 2\n0: 1\n", "1: 0\n", "1 2: 1\n", "1: 2 a\n"})
+    {
+        std::stringstream mockStream(fileContent);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeLstFile(mockStream), TypeParam{});
+    }
+}
+
+TYPED_TEST(DeserializerTest, filesLargerThanReadWindowRoundTrip)
+{
+    auto graph = this->createLargeRandomGraph();
+    std::stringstream matStream = {};
+    Serializer::serializeMatFile(matStream, graph);
+    std::stringstream lstStream = {};
+    Serializer::serializeLstFile(lstStream, graph);
+
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeMatFile(matStream), graph);
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeLstFile(lstStream), graph);
+}
+
+TYPED_TEST(DeserializerTest, lineLongerThanReadWindowIsParsed)
+{
+    std::stringstream mockStream("1:" + std::string(100000, ' ') + "2\n2:\n");
+    auto graph = DeserializerTest<TypeParam>::sut::deserializeLstFile(mockStream);
+
+    TypeParam referenceGraph = {};
+    referenceGraph.addNodes(2);
+    referenceGraph.setEdge({.source = 1, .destination = 2});
+    EXPECT_EQ(graph, referenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, mappedFilesGiveSameGraphsAsStreams)
+{
+    auto graph = this->createLargeRandomGraph();
+    std::stringstream matStream = {};
+    Serializer::serializeMatFile(matStream, graph);
+    std::stringstream lstStream = {};
+    Serializer::serializeLstFile(lstStream, graph);
+    auto [graphMlContent, graphMlReferenceGraph] = this->helper.makeSampleGraphMlFile();
+
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(this->writeTemporaryFile(matStream.str())), graph);
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadLstFile(this->writeTemporaryFile(lstStream.str())), graph);
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadGraphMlFile(this->writeTemporaryFile(graphMlContent)),
+              graphMlReferenceGraph);
+}
+
+TYPED_TEST(DeserializerTest, loadingEmptyOrMissingFileReturnsEmptyGraph)
+{
+    const auto& emptyFile = this->writeTemporaryFile("");
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(emptyFile), TypeParam{});
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadLstFile(emptyFile), TypeParam{});
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadGraphMlFile(emptyFile), TypeParam{});
+
+    auto missingFile = emptyFile.parent_path() / "GraphCakeMissingFile.mat";
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(missingFile), TypeParam{});
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(emptyFile.parent_path()), TypeParam{});
+}
+
+TYPED_TEST(DeserializerTest, filesSplitIntoChunksGiveSameGraphsForAnyThreadsCount)
+{
+    constexpr uint32_t nodesCount = 1200;
+    std::mt19937 generator{17};
+    std::bernoulli_distribution isEdge{0.01};
+    std::uniform_int_distribution<WeightType> weights{1, 9};
+    std::string matContent = {};
+    std::string lstContent = {};
+    std::vector<EdgeInfo> weightedEdges = {};
+    std::vector<EdgeInfo> edges = {};
+    for (NodeId source = 1; source <= nodesCount; source++)
+    {
+        lstContent += std::format("{}:", source);
+        for (NodeId destination = 1; destination <= nodesCount; destination++)
+        {
+            auto weight = isEdge(generator) ? weights(generator) : 0;
+            matContent += std::format("{} ", weight);
+            if (weight != 0)
+            {
+                weightedEdges.push_back({source, destination, weight});
+                edges.push_back({source, destination});
+                lstContent += std::format(" {}", destination);
+            }
+        }
+        matContent += "\n";
+        // Pads the list as well beyond the size at which files are split.
+        lstContent += std::string(nodesCount * 2, ' ') + "\n";
+    }
+
+    TypeParam matReferenceGraph = {};
+    matReferenceGraph.addNodes(nodesCount);
+    matReferenceGraph.setEdges(weightedEdges);
+    TypeParam lstReferenceGraph = {};
+    lstReferenceGraph.addNodes(nodesCount);
+    lstReferenceGraph.setEdges(edges);
+    for (uint32_t threadsCount : {1u, 8u})
+    {
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(this->writeTemporaryFile(matContent), threadsCount),
+                  matReferenceGraph);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadLstFile(this->writeTemporaryFile(lstContent), threadsCount),
+                  lstReferenceGraph);
+    }
+
+    matContent.replace(matContent.size() - 3, 1, "x");
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(this->writeTemporaryFile(matContent), 8), TypeParam{});
+    matContent.replace(matContent.size() - 3, 1, "0 0");
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadMatFile(this->writeTemporaryFile(matContent), 8), TypeParam{});
+}
+
+TYPED_TEST(DeserializerTest, starWithHighDegreeHubIsLoaded)
+{
+    constexpr uint32_t leavesCount = 3000;
+    constexpr NodeId hub = 1;
+    std::string lstContent = std::format("{}:", hub);
+    for (NodeId leaf = leavesCount + 1; leaf > hub; leaf--)
+    {
+        lstContent += std::format(" {}", leaf);
+    }
+    lstContent += "\n";
+    for (NodeId leaf = hub + 1; leaf <= leavesCount + 1; leaf++)
+    {
+        lstContent += std::format("{}:\n", leaf);
+    }
+
+    auto graph = DeserializerTest<TypeParam>::sut::loadLstFile(this->writeTemporaryFile(lstContent), 8);
+    ASSERT_EQ(graph.nodesAmount(), leavesCount + 1);
+    EXPECT_EQ(graph.getOutgoingDegree(hub), leavesCount);
+    EXPECT_EQ(graph.graphDegree(), leavesCount);
+    auto neighbors = graph.getOutgoingNeighborsOf(hub);
+    EXPECT_TRUE(std::ranges::is_sorted(neighbors));
+    EXPECT_EQ(neighbors.front(), hub + 1);
+    EXPECT_EQ(neighbors.back(), leavesCount + 1);
+    for (NodeId leaf = hub + 1; leaf <= leavesCount + 1; leaf++)
+    {
+        EXPECT_THAT(graph.getIncommingNeighborsOf(leaf), ElementsAre(hub));
+    }
+}
+
+TYPED_TEST(DeserializerTest, graphMlFilesLargerThanWriteBufferRoundTripWithWeights)
+{
+    constexpr uint32_t nodesCount = 2000;
+    TypeParam graph = {};
+    graph.addNodes(nodesCount);
+    std::mt19937 generator{19};
+    std::uniform_int_distribution<NodeId> nodes{1, nodesCount};
+    std::uniform_int_distribution<WeightType> weights{-9, 9};
+    std::vector<EdgeInfo> edges = {};
+    for (uint32_t i = 0; i < nodesCount * 15; i++)
+    {
+        edges.push_back({nodes(generator), nodes(generator), weights(generator)});
+    }
+    graph.setEdges(edges);
+    std::stringstream graphMlStream = {};
+    Serializer::serializeGraphMlFile(graphMlStream, graph);
+
+    EXPECT_GT(graphMlStream.str().size(), 1 << 20);
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeGraphMlFile(graphMlStream), graph);
+}
+
+TYPED_TEST(DeserializerTest, binarySnapshotsRoundTrip)
+{
+    auto [lstContent, unweightedGraph] = this->helper.makeSampleLstFile();
+    auto weightedGraph = this->createLargeRandomGraph();
+    for (const auto* graph : {&unweightedGraph, &weightedGraph})
+    {
+        std::stringstream binaryStream = {};
+        Serializer::serializeBinaryFile(binaryStream, *graph);
+
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadBinaryFile(this->writeTemporaryFile(binaryStream.str())),
+                  *graph);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeBinaryFile(binaryStream), *graph);
+    }
+}
+
+TYPED_TEST(DeserializerTest, binarySnapshotsOfCsrGraphsLoadIntoAnyRepresentation)
+{
+    using CsrGraphType = CsrGraph<TypeParam::Directionality>;
+    auto graph = this->createLargeRandomGraph();
+    CsrGraphType csrGraph(graph);
+    std::stringstream binaryStream = {};
+    Serializer::serializeBinaryFile(binaryStream, csrGraph);
+    const auto& binaryFile = this->writeTemporaryFile(binaryStream.str());
+
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadBinaryFile(binaryFile), graph);
+    auto loadedCsrGraph = Deserializer<CsrGraphType>::loadBinaryFile(binaryFile);
+    EXPECT_EQ(loadedCsrGraph, graph);
+    EXPECT_EQ(loadedCsrGraph.graphDegree(), csrGraph.graphDegree());
+}
+
+TYPED_TEST(DeserializerTest, invalidBinarySnapshotsReturnEmptyGraph)
+{
+    std::stringstream binaryStream = {};
+    Serializer::serializeBinaryFile(binaryStream, this->createLargeRandomGraph());
+    const auto snapshot = binaryStream.str();
+    auto loadModified = [this, &snapshot](std::size_t position, std::string bytes) {
+        auto modified = snapshot;
+        modified.replace(position, bytes.size(), bytes);
+        std::stringstream modifiedStream(modified);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeBinaryFile(modifiedStream), TypeParam{});
+        return DeserializerTest<TypeParam>::sut::loadBinaryFile(this->writeTemporaryFile(modified));
+    };
+
+    EXPECT_EQ(loadModified(0, "GRAPHCAT"), TypeParam{});
+    EXPECT_EQ(loadModified(8, std::string(1, '\x02')), TypeParam{});
+    EXPECT_EQ(loadModified(12, std::string(1, snapshot[12] == 0 ? '\x01' : '\x00')), TypeParam{});
+    // The first neighbor id becomes larger than the amount of nodes.
+    auto neighborsPosition = sizeof(BinaryFileHeader) + (300 + 1) * sizeof(uint32_t) + sizeof(uint32_t);
+    EXPECT_EQ(loadModified(neighborsPosition, std::string(4, '\xff')), TypeParam{});
+    // The amount of edges claims far more neighbor ids than the snapshot holds.
+    EXPECT_EQ(loadModified(24, std::string("\xff\xff\xff\x7f", 4)), TypeParam{});
+
+    if constexpr (TypeParam::Directionality == GraphDirectionality::undirected)
+    {
+        TypeParam graph = {};
+        graph.addNodes(3);
+        graph.setEdge({.source = 1, .destination = 2});
+        std::stringstream smallStream = {};
+        Serializer::serializeBinaryFile(smallStream, graph);
+        auto asymmetric = smallStream.str();
+        // The row of the first node lists the third one, which still lists nothing back.
+        asymmetric.replace(sizeof(BinaryFileHeader) + (3 + 1) * sizeof(uint32_t), 1, std::string(1, '\x03'));
+        std::stringstream asymmetricStream(asymmetric);
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::deserializeBinaryFile(asymmetricStream), TypeParam{});
+        EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadBinaryFile(this->writeTemporaryFile(asymmetric)), TypeParam{});
+    }
+
+    const auto& truncatedFile = this->writeTemporaryFile(snapshot.substr(0, snapshot.size() / 2));
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadBinaryFile(truncatedFile), TypeParam{});
+    EXPECT_EQ(DeserializerTest<TypeParam>::sut::loadBinaryFile(this->writeTemporaryFile("")), TypeParam{});
+}
 } // namespace Graphs
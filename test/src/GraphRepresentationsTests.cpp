@@ -2,7 +2,9 @@
 #include <GraphRepresentationHelpers.hpp>
 #include <Graphs/Graph.hpp>
 #include <gtest/gtest.h>
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace testing;
 
@@ -161,6 +163,38 @@ TYPED_TEST(GraphRepresentationsTests, canUpdateMultipleEdges)
     EXPECT_EQ(this->sut.findEdge({firstNodeId, secondNodeId}).weight, 5);
 }
 
+TYPED_TEST(GraphRepresentationsTests, settingEdgesAtOnceGivesTheSameGraphAsSettingThemOneByOne)
+{
+    constexpr uint32_t nodesCount = 200;
+    std::mt19937 generator{23};
+    // Ids past the last node are drawn as well, and such edges have to be skipped.
+    std::uniform_int_distribution<NodeId> nodes{1, nodesCount + 2};
+    std::uniform_int_distribution<WeightType> weights{0, 9};
+    std::vector<EdgeInfo> edges = {};
+    for (uint32_t i = 0; i < nodesCount * 10; i++)
+    {
+        auto weight = weights(generator);
+        edges.push_back({nodes(generator), nodes(generator), weight == 0 ? std::nullopt : std::optional{weight}});
+    }
+
+    auto graph = makeRandomGraph<TypeParam>(nodesCount, nodesCount * 2, 29, {{1, 9}});
+    auto referenceGraph = makeRandomGraph<TypeParam>(nodesCount, nodesCount * 2, 29, {{1, 9}});
+    for (const auto& edge : edges)
+    {
+        referenceGraph.setEdge(edge);
+    }
+    graph.setEdges(edges);
+
+    EXPECT_EQ(graph, referenceGraph);
+    EXPECT_EQ(graph.graphDegree(), referenceGraph.graphDegree());
+    for (auto node : referenceGraph.getNodeIds())
+    {
+        EXPECT_EQ(graph.degreeOf(node), referenceGraph.degreeOf(node));
+        EXPECT_EQ(graph.getOutgoingDegree(node), referenceGraph.getOutgoingDegree(node));
+        EXPECT_EQ(graph.getIncommingNeighborsOf(node), referenceGraph.getIncommingNeighborsOf(node));
+    }
+}
+
 TYPED_TEST(GraphRepresentationsTests, settingEdgeBetweenNonexistantNodesDoesNotDoAnything)
 {
     this->sut.addNodes(oneNode);
@@ -190,6 +224,65 @@ TYPED_TEST(GraphRepresentationsTests, nodesAfterRemovedNoteAreCorrectlyIdentifie
     EXPECT_EQ(searchedEdge.weight.value(), 1);
 }
 
+TYPED_TEST(GraphRepresentationsTests, addingNodesInBatchesPreservesExistingEdges)
+{
+    this->sut.addNodes(threeNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId, 4});
+    this->sut.setEdge({secondNodeId, firstNodeId});
+    this->sut.addNodes(oneNode);
+    this->sut.addNodes(fourNodes);
+
+    EXPECT_EQ(this->sut.nodesAmount(), 8);
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, thirdNodeId}).weight, 4);
+    EXPECT_EQ(this->sut.findEdge({secondNodeId, firstNodeId}).weight, 1);
+    EXPECT_EQ(this->sut.getIncommingDegree(thirdNodeId), 1);
+    EXPECT_EQ(this->sut.getOutgoingDegree(8), 0);
+}
+
+TYPED_TEST(GraphRepresentationsTests, removingNodeKeepsEdgesOnBothSidesOfIt)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({firstNodeId, 4, 2});
+    this->sut.setEdge({4, thirdNodeId, 3});
+    this->sut.setEdge({thirdNodeId, secondNodeId});
+    this->sut.removeNode(secondNodeId);
+
+    EXPECT_EQ(this->sut.findEdge({firstNodeId, 4}).weight, 2);
+    EXPECT_EQ(this->sut.findEdge({4, thirdNodeId}).weight, 3);
+    auto expectedDegree = TypeParam::Directionality == GraphDirectionality::directed ? 0 : 1;
+    EXPECT_EQ(this->sut.getOutgoingDegree(thirdNodeId), expectedDegree);
+    EXPECT_THAT(this->sut.getIncommingNeighborsOf(thirdNodeId), ElementsAre(4));
+}
+
+TYPED_TEST(GraphRepresentationsTests, graphDegreeFollowsEdgeAndNodeChanges)
+{
+    this->sut.addNodes(fourNodes);
+    EXPECT_EQ(this->sut.graphDegree(), 0);
+
+    this->sut.setEdges({
+        {firstNodeId, secondNodeId},
+        {firstNodeId,  thirdNodeId},
+        {firstNodeId,            4},
+        {secondNodeId, thirdNodeId}
+    });
+    EXPECT_EQ(this->sut.graphDegree(), 3);
+    EXPECT_EQ(this->sut.degreeOf(firstNodeId), 3);
+
+    this->sut.setEdge({firstNodeId, 4, 7});
+    EXPECT_EQ(this->sut.graphDegree(), 3);
+
+    this->sut.removeEdge({firstNodeId, 4});
+    EXPECT_EQ(this->sut.degreeOf(firstNodeId), 2);
+
+    this->sut.removeNode(firstNodeId);
+    EXPECT_EQ(this->sut.graphDegree(), 1);
+    EXPECT_EQ(this->sut.degreeOf(thirdNodeId), 1);
+    EXPECT_EQ(this->sut.degreeOf(firstNodeId), 0);
+
+    this->sut.reset();
+    EXPECT_EQ(this->sut.graphDegree(), 0);
+}
+
 TYPED_TEST(GraphRepresentationsTests, gettingNodesListOfGraphWithOnlyOneNodeHasOnlyOneElement)
 {
     this->sut.addNodes(oneNode);
@@ -197,6 +290,82 @@ TYPED_TEST(GraphRepresentationsTests, gettingNodesListOfGraphWithOnlyOneNodeHasO
     EXPECT_THAT(nodes, ElementsAre(firstNodeId));
 }
 
+TYPED_TEST(GraphRepresentationsTests, forEachNodeVisitsAllRemainingNodes)
+{
+    this->sut.addNodes(threeNodes);
+    this->sut.removeNode(secondNodeId);
+
+    std::vector<NodeId> visited = {};
+    this->sut.forEachNode([&visited](NodeId node) {
+        visited.push_back(node);
+    });
+    EXPECT_THAT(visited, ElementsAre(firstNodeId, thirdNodeId));
+}
+
+TYPED_TEST(GraphRepresentationsTests, forEachNeighborVisitsTheSameNodesAsGetNeighborsOf)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId});
+    this->sut.setEdge({thirdNodeId, firstNodeId});
+    this->sut.setEdge({secondNodeId, firstNodeId});
+
+    std::vector<NodeId> visited = {};
+    this->sut.forEachNeighbor(firstNodeId, [&visited](NodeId node) {
+        visited.push_back(node);
+    });
+    std::ranges::sort(visited);
+    EXPECT_EQ(visited, this->sut.getNeighborsOf(firstNodeId));
+}
+
+TYPED_TEST(GraphRepresentationsTests, forEachOutgoingAndIncommingNeighborVisitTheSameNodesAsGetters)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId});
+    this->sut.setEdge({secondNodeId, firstNodeId});
+
+    std::vector<NodeId> outgoing = {};
+    std::vector<NodeId> incomming = {};
+    this->sut.forEachOutgoingNeighbor(firstNodeId, [&outgoing](NodeId node) {
+        outgoing.push_back(node);
+    });
+    this->sut.forEachIncommingNeighbor(firstNodeId, [&incomming](NodeId node) {
+        incomming.push_back(node);
+    });
+    std::ranges::sort(outgoing);
+    std::ranges::sort(incomming);
+    EXPECT_EQ(outgoing, this->sut.getOutgoingNeighborsOf(firstNodeId));
+    EXPECT_EQ(incomming, this->sut.getIncommingNeighborsOf(firstNodeId));
+}
+
+TYPED_TEST(GraphRepresentationsTests, incommingNeighborsFollowMutationsMadeAfterAColumnScan)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({secondNodeId, firstNodeId});
+    EXPECT_THAT(this->sut.getIncommingNeighborsOf(firstNodeId), ElementsAre(secondNodeId));
+
+    this->sut.setEdge({thirdNodeId, firstNodeId});
+    this->sut.removeEdge({secondNodeId, firstNodeId});
+    EXPECT_THAT(this->sut.getIncommingNeighborsOf(firstNodeId), ElementsAre(thirdNodeId));
+
+    this->sut.removeNode(secondNodeId);
+    this->sut.addNodes(oneNode);
+    EXPECT_THAT(this->sut.getIncommingNeighborsOf(firstNodeId), ElementsAre(thirdNodeId));
+}
+
+TYPED_TEST(GraphRepresentationsTests, forEachOutgoingEdgeVisitsNeighborsWithTheirWeights)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId, 7});
+    this->sut.setEdge({firstNodeId, secondNodeId});
+
+    std::vector<std::pair<NodeId, WeightType>> visited = {};
+    this->sut.forEachOutgoingEdge(firstNodeId, [&visited](NodeId node, WeightType weight) {
+        visited.emplace_back(node, weight);
+    });
+    std::ranges::sort(visited);
+    EXPECT_THAT(visited, ElementsAre(Pair(secondNodeId, 1), Pair(thirdNodeId, 7)));
+}
+
 TYPED_TEST(GraphRepresentationsTests, spaceshipOperatorCorrectlyComparesGraphsBasedOnNodesCount)
 {
     auto smallerGraph = this->sut;
@@ -311,6 +480,25 @@ TYPED_TEST(DirectedGraphRepresentationsTests, removingDirectedEdgeInACyclicDirec
     EXPECT_EQ(this->sut.getIncommingDegree(firstNodeId), 1);
 }
 
+TYPED_TEST(DirectedGraphRepresentationsTests, incommingNeighborsAreUpdatedWhenNeighborIsRemoved)
+{
+    this->sut.addNodes(fourNodes);
+    this->sut.setEdge({firstNodeId, thirdNodeId});
+    this->sut.setEdge({secondNodeId, thirdNodeId});
+    this->sut.setEdge({thirdNodeId, secondNodeId});
+    this->sut.setEdge({thirdNodeId, thirdNodeId});
+
+    this->sut.removeNode(secondNodeId);
+
+    EXPECT_THAT(this->sut.getIncommingNeighborsOf(thirdNodeId), ElementsAre(firstNodeId, thirdNodeId));
+    EXPECT_THAT(this->sut.getOutgoingNeighborsOf(thirdNodeId), ElementsAre(thirdNodeId));
+
+    this->sut.removeNode(thirdNodeId);
+
+    EXPECT_EQ(this->sut.getOutgoingDegree(firstNodeId), 0);
+    EXPECT_TRUE(this->sut.getEdges().empty());
+}
+
 template <typename GraphType>
 struct UndirectedGraphRepresentationsTests : public GraphRepresentationsTests<GraphType>
 {};
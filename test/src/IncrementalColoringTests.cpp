@@ -0,0 +1,153 @@
+#include <gmock/gmock.h>
+#include <GraphRepresentationHelpers.hpp>
+#include <Graphs/IncrementalColoring.hpp>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace testing;
+
+namespace Graphs::Algorithm
+{
+template <typename GraphType>
+class IncrementalColoringTests : public testing::Test
+{
+protected:
+    void createTriangle()
+    {
+        graph.addNodes(3);
+        graph.setEdges({
+            {1, 2},
+            {2, 3},
+            {1, 3}
+        });
+    }
+
+    void expectProperColoring(const IncrementalColoring& sut)
+    {
+        ASSERT_EQ(sut.getColoring().size(), graph.nodesAmount());
+        for (const auto& edge : graph.getEdges())
+        {
+            if (edge.source != edge.destination)
+            {
+                EXPECT_NE(sut.colorOf(edge.source), sut.colorOf(edge.destination));
+            }
+        }
+        for (auto [node, color] : sut.getColoring())
+        {
+            EXPECT_LT(color, sut.colorsSpan());
+        }
+    }
+
+    GraphType graph = {};
+};
+
+TYPED_TEST_SUITE(IncrementalColoringTests, GraphTypes);
+
+TYPED_TEST(IncrementalColoringTests, attachingColorsTheWholeGraph)
+{
+    this->createTriangle();
+    IncrementalColoring sut(this->graph);
+
+    EXPECT_EQ(sut.colorsCount(), 3);
+    EXPECT_EQ(sut.recoloringsCount(), 0);
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, conflictingEdgeRecolorsOneEndpoint)
+{
+    this->graph.addNodes(4);
+    this->graph.setEdges({
+        {1, 2},
+        {3, 4}
+    });
+    IncrementalColoring sut(this->graph);
+    ASSERT_EQ(sut.colorOf(1), sut.colorOf(3));
+
+    sut.setEdge({1, 3});
+
+    EXPECT_EQ(sut.recoloringsCount(), 1);
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, removingEdgeMovesEndpointToFreedColor)
+{
+    this->createTriangle();
+    IncrementalColoring sut(this->graph);
+
+    sut.removeEdge({2, 3});
+    if constexpr (TypeParam::Directionality == GraphDirectionality::directed)
+    {
+        sut.removeEdge({3, 2});
+    }
+
+    EXPECT_EQ(sut.colorsCount(), 2);
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, colorsCountSkipsGapsLeftByLoweredColors)
+{
+    this->createTriangle();
+    IncrementalColoring sut(this->graph);
+    ASSERT_EQ(sut.colorOf(2), 1);
+    ASSERT_EQ(sut.colorOf(3), 2);
+
+    sut.removeEdge({1, 2});
+
+    EXPECT_EQ(sut.colorOf(2), 0);
+    EXPECT_EQ(sut.colorsCount(), 2);
+    EXPECT_EQ(sut.colorsSpan(), 3);
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, removingNodeFreesColorOfItsNeighbors)
+{
+    this->createTriangle();
+    IncrementalColoring sut(this->graph);
+
+    sut.removeNode(1);
+
+    EXPECT_EQ(sut.colorOf(1), IncrementalColoring::uncolored);
+    EXPECT_EQ(sut.colorsCount(), 2);
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, nodesAddedAfterRemovalFollowIdsOfTheGraph)
+{
+    this->createTriangle();
+    IncrementalColoring sut(this->graph);
+
+    sut.removeNode(3);
+    sut.addNodes(2);
+    sut.setEdge({3, 1});
+    sut.setEdge({4, 2});
+
+    EXPECT_THAT(this->graph.getNodeIds(), ElementsAre(1, 2, 3, 4));
+    this->expectProperColoring(sut);
+}
+
+TYPED_TEST(IncrementalColoringTests, coloringStaysProperUnderStreamOfMutations)
+{
+    constexpr uint32_t nodesCount = 300;
+    constexpr uint32_t mutationsCount = 3000;
+    this->graph.addNodes(nodesCount);
+    IncrementalColoring sut(this->graph, 500);
+
+    std::mt19937 generator{11};
+    std::uniform_int_distribution<NodeId> nodes{1, nodesCount};
+    std::bernoulli_distribution isInsertion{0.7};
+    for (uint32_t i = 0; i < mutationsCount; i++)
+    {
+        if (isInsertion(generator))
+        {
+            sut.setEdge({nodes(generator), nodes(generator)});
+        }
+        else
+        {
+            sut.removeEdge({nodes(generator), nodes(generator)});
+        }
+    }
+
+    EXPECT_LE(sut.colorsCount(), this->graph.graphDegree() + 1);
+    this->expectProperColoring(sut);
+}
+} // namespace Graphs::Algorithm
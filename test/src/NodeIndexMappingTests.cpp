@@ -0,0 +1,91 @@
+#include <gmock/gmock.h>
+#include <Graphs/NodeIndexMapping.hpp>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace Graphs
+{
+class NodeIndexMappingTests : public testing::Test
+{
+protected:
+    NodeIndexMapping sut;
+};
+
+TEST_F(NodeIndexMappingTests, defaultConstructedMappingIsEmpty)
+{
+    EXPECT_TRUE(this->sut.empty());
+    EXPECT_EQ(this->sut.indexOf(1), NodeIndexMapping::invalidIndex);
+}
+
+TEST_F(NodeIndexMappingTests, addedNodesAreMappedToConsecutiveIndices)
+{
+    this->sut.addNodes(3);
+    EXPECT_EQ(this->sut.size(), 3);
+    EXPECT_EQ(this->sut.indexOf(1), 0);
+    EXPECT_EQ(this->sut.indexOf(3), 2);
+    EXPECT_EQ(this->sut.idOf(1), 2);
+    EXPECT_EQ(this->sut.indexOf(0), NodeIndexMapping::invalidIndex);
+    EXPECT_EQ(this->sut.indexOf(4), NodeIndexMapping::invalidIndex);
+}
+
+TEST_F(NodeIndexMappingTests, removingNodeCompactsIndicesOfFollowingNodes)
+{
+    this->sut.addNodes(4);
+    EXPECT_EQ(this->sut.removeNode(2), 1);
+
+    EXPECT_THAT(this->sut.ids(), ElementsAre(1, 3, 4));
+    EXPECT_FALSE(this->sut.contains(2));
+    EXPECT_EQ(this->sut.indexOf(3), 1);
+    EXPECT_EQ(this->sut.indexOf(4), 2);
+    EXPECT_EQ(this->sut.idOf(2), 4);
+}
+
+TEST_F(NodeIndexMappingTests, removingMissingNodeReturnsInvalidIndex)
+{
+    this->sut.addNodes(2);
+    EXPECT_EQ(this->sut.removeNode(5), NodeIndexMapping::invalidIndex);
+    EXPECT_EQ(this->sut.size(), 2);
+}
+
+TEST_F(NodeIndexMappingTests, addingNodesAfterRemovalContinuesFromHighestId)
+{
+    this->sut.addNodes(3);
+    this->sut.removeNode(1);
+    this->sut.addNodes(2);
+
+    EXPECT_THAT(this->sut.ids(), ElementsAre(2, 3, 4, 5));
+    EXPECT_EQ(this->sut.indexOf(5), 3);
+    EXPECT_EQ(this->sut.indexOf(1), NodeIndexMapping::invalidIndex);
+}
+
+TEST_F(NodeIndexMappingTests, mappingBuiltFromSparseIdsResolvesAllOfThem)
+{
+    NodeIndexMapping mapping({2, 7, 9});
+
+    EXPECT_EQ(mapping.indexOf(2), 0);
+    EXPECT_EQ(mapping.indexOf(7), 1);
+    EXPECT_EQ(mapping.indexOf(9), 2);
+    EXPECT_EQ(mapping.indexOf(3), NodeIndexMapping::invalidIndex);
+    EXPECT_EQ(mapping.indexOf(10), NodeIndexMapping::invalidIndex);
+}
+
+TEST_F(NodeIndexMappingTests, mappingBuiltFromIdsStartingAtZeroResolvesAllOfThem)
+{
+    NodeIndexMapping mapping({0, 2});
+
+    EXPECT_EQ(mapping.indexOf(0), 0);
+    EXPECT_EQ(mapping.indexOf(2), 1);
+    EXPECT_EQ(mapping.indexOf(1), NodeIndexMapping::invalidIndex);
+}
+
+TEST_F(NodeIndexMappingTests, clearRemovesAllNodes)
+{
+    this->sut.addNodes(3);
+    this->sut.removeNode(2);
+    this->sut.clear();
+
+    EXPECT_TRUE(this->sut.empty());
+    EXPECT_EQ(this->sut.indexOf(3), NodeIndexMapping::invalidIndex);
+}
+} // namespace Graphs
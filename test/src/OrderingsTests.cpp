@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <GraphRepresentationHelpers.hpp>
+#include <Graphs/Orderings.hpp>
+#include <gtest/gtest.h>
+#include <ranges>
+
+using namespace testing;
+using namespace Graphs::Algorithm;
+
+namespace Graphs
+{
+template <typename GraphType>
+class OrderingsTests : public testing::Test
+{
+protected:
+    GraphType createStarWithTail()
+    {
+        GraphType graph = {};
+        graph.addNodes(7);
+        graph.setEdges({
+            {.source = 4, .destination = 1},
+            {.source = 4, .destination = 2},
+            {.source = 4, .destination = 3},
+            {.source = 5, .destination = 4},
+            {.source = 5, .destination = 6}
+        });
+        return graph;
+    }
+};
+
+TYPED_TEST_SUITE(OrderingsTests, GraphTypes);
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingOfEmptyGraphIsEmpty)
+{
+    TypeParam graph = {};
+    EXPECT_TRUE(largestFirstOrdering(graph).empty());
+}
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingContainsEveryNodeIncludingIsolatedOnes)
+{
+    auto graph = this->createStarWithTail();
+    auto ordering = largestFirstOrdering(graph);
+
+    ASSERT_EQ(ordering.size(), graph.nodesAmount());
+    EXPECT_EQ(ordering.back(), 7);
+}
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingSortsByNonIncreasingDegree)
+{
+    auto graph = this->createStarWithTail();
+    auto ordering = largestFirstOrdering(graph);
+
+    for (std::size_t i = 1; i < ordering.size(); i++)
+    {
+        EXPECT_GE(graph.degreeOf(ordering[i - 1]), graph.degreeOf(ordering[i]));
+    }
+    EXPECT_EQ(ordering.front(), 4);
+}
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingBreaksTiesById)
+{
+    auto graph = this->createStarWithTail();
+    EXPECT_THAT(largestFirstOrdering(graph, TieBreak::byId), ElementsAre(4, 5, 1, 2, 3, 6, 7));
+}
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingWithRandomTieBreakIsReproducibleForTheSameSeed)
+{
+    auto graph = this->createStarWithTail();
+    auto ordering = largestFirstOrdering(graph, TieBreak::random, 42);
+
+    EXPECT_EQ(ordering, largestFirstOrdering(graph, TieBreak::random, 42));
+    EXPECT_EQ(ordering.front(), 4);
+    auto sorted = ordering;
+    std::ranges::sort(sorted);
+    EXPECT_EQ(sorted, graph.getNodeIds());
+}
+
+TYPED_TEST(OrderingsTests, largestFirstOrderingCanBreakTiesByIncommingDegree)
+{
+    TypeParam graph = {};
+    graph.addNodes(4);
+    graph.setEdges({
+        {.source = 1, .destination = 2},
+        {.source = 3, .destination = 4},
+        {.source = 4, .destination = 3}
+    });
+
+    if constexpr (TypeParam::Directionality == GraphDirectionality::directed)
+    {
+        EXPECT_THAT(largestFirstOrdering(graph, TieBreak::incommingDegree), ElementsAre(2, 3, 4, 1));
+    }
+    else
+    {
+        EXPECT_THAT(largestFirstOrdering(graph, TieBreak::incommingDegree), ElementsAre(1, 2, 3, 4));
+    }
+}
+TYPED_TEST(OrderingsTests, smallestLastOrderingOfEmptyGraphIsEmpty)
+{
+    TypeParam graph = {};
+    auto [ordering, degeneracy, coreNumbers] = smallestLastOrdering(graph);
+
+    EXPECT_TRUE(ordering.empty());
+    EXPECT_EQ(degeneracy, 0);
+    EXPECT_TRUE(coreNumbers.empty());
+}
+
+TYPED_TEST(OrderingsTests, smallestLastOrderingPutsNodesOfTheDensestCoreFirst)
+{
+    TypeParam graph = {};
+    graph.addNodes(7);
+    graph.setEdges({
+        {.source = 1, .destination = 2},
+        {.source = 1, .destination = 3},
+        {.source = 1, .destination = 4},
+        {.source = 2, .destination = 3},
+        {.source = 2, .destination = 4},
+        {.source = 3, .destination = 4},
+        {.source = 4, .destination = 5},
+        {.source = 5, .destination = 6}
+    });
+
+    auto [ordering, degeneracy, coreNumbers] = smallestLastOrdering(graph);
+
+    ASSERT_EQ(ordering.size(), 7);
+    auto clique = std::vector<NodeId>(ordering.begin(), ordering.begin() + 4);
+    std::ranges::sort(clique);
+    EXPECT_THAT(clique, ElementsAre(1, 2, 3, 4));
+    EXPECT_EQ(ordering.back(), 7);
+    EXPECT_EQ(degeneracy, 3);
+    EXPECT_THAT(coreNumbers,
+                ElementsAre(Pair(1, 3), Pair(2, 3), Pair(3, 3), Pair(4, 3), Pair(5, 1), Pair(6, 1), Pair(7, 0)));
+}
+
+TYPED_TEST(OrderingsTests, smallestLastOrderingEveryNodeHasAtMostDegeneracyEarlierNeighbors)
+{
+    auto graph = this->createStarWithTail();
+    auto [ordering, degeneracy, _] = smallestLastOrdering(graph);
+
+    EXPECT_EQ(degeneracy, 1);
+    for (std::size_t position = 0; position < ordering.size(); position++)
+    {
+        uint32_t earlierNeighbors = 0;
+        graph.forEachNeighbor(ordering[position], [&](NodeId neighbor) {
+            auto neighborPosition = std::ranges::find(ordering, neighbor) - ordering.begin();
+            earlierNeighbors += neighborPosition < static_cast<std::ptrdiff_t>(position) ? 1 : 0;
+        });
+        EXPECT_LE(earlierNeighbors, degeneracy);
+    }
+}
+
+TYPED_TEST(OrderingsTests, smallestLastOrderingAlwaysRemovesNodeOfMinimalRemainingDegree)
+{
+    // A triangle next to a 5-cycle: removing node 1 leaves nodes 7 and 8 with degree 1 below the cycle.
+    TypeParam graph = {};
+    graph.addNodes(8);
+    graph.setEdges({
+        {.source = 1, .destination = 7},
+        {.source = 7, .destination = 8},
+        {.source = 8, .destination = 1},
+        {.source = 2, .destination = 3},
+        {.source = 3, .destination = 4},
+        {.source = 4, .destination = 5},
+        {.source = 5, .destination = 6},
+        {.source = 6, .destination = 2}
+    });
+
+    auto [ordering, degeneracy, coreNumbers] = smallestLastOrdering(graph);
+
+    std::vector<NodeId> remaining = graph.getNodeIds();
+    auto remainingDegree = [&graph, &remaining](NodeId node) {
+        uint32_t degree = 0;
+        graph.forEachNeighbor(node, [&remaining, &degree](NodeId neighbor) {
+            degree += std::ranges::find(remaining, neighbor) != remaining.end() ? 1 : 0;
+        });
+        return degree;
+    };
+    for (auto node : ordering | std::views::reverse)
+    {
+        auto minimalDegree = std::ranges::min(remaining | std::views::transform(remainingDegree));
+        EXPECT_EQ(remainingDegree(node), minimalDegree) << "node " << node;
+        std::erase(remaining, node);
+    }
+    EXPECT_EQ(degeneracy, 2);
+    EXPECT_THAT(coreNumbers, Each(Pair(_, 2)));
+}
+
+TYPED_TEST(OrderingsTests, smallestLastOrderingKeepsOriginalIdsAfterNodeRemoval)
+{
+    auto graph = this->createStarWithTail();
+    graph.removeNode(5);
+    auto [ordering, degeneracy, coreNumbers] = smallestLastOrdering(graph);
+
+    std::ranges::sort(ordering);
+    EXPECT_THAT(ordering, ElementsAre(1, 2, 3, 4, 6, 7));
+    EXPECT_EQ(coreNumbers.size(), 6);
+}
+} // namespace Graphs
@@ -9,6 +9,7 @@ std::string getSampleDirectedGraphMlContent()
            "    xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
            "    xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns\n"
            "    http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">\n"
+           "  <key id=\"weight\" for=\"edge\" attr.name=\"weight\" attr.type=\"int\"><default>1</default></key>\n"
            "  <graph id=\"Graph\" edgedefault=\"directed\">\n"
            "    <node id=\"n0\"/>\n"
            "    <node id=\"n1\"/>\n"
@@ -17,8 +18,8 @@ std::string getSampleDirectedGraphMlContent()
            "    <node id=\"n4\"/>\n"
            "    <edge source=\"n0\" target=\"n1\"/>\n"
            "    <edge source=\"n1\" target=\"n0\"/>\n"
-           "    <edge source=\"n2\" target=\"n3\"/>\n"
-           "    <edge source=\"n3\" target=\"n2\"/>\n"
+           "    <edge source=\"n2\" target=\"n3\"><data key=\"weight\">5</data></edge>\n"
+           "    <edge source=\"n3\" target=\"n2\"><data key=\"weight\">5</data></edge>\n"
            "  </graph>\n"
            "</graphml>";
 }
@@ -30,6 +31,7 @@ std::string getSampleUndirectedGraphMlContent()
            "    xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
            "    xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns\n"
            "    http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">\n"
+           "  <key id=\"weight\" for=\"edge\" attr.name=\"weight\" attr.type=\"int\"><default>1</default></key>\n"
            "  <graph id=\"Graph\" edgedefault=\"undirected\">\n"
            "    <node id=\"n0\"/>\n"
            "    <node id=\"n1\"/>\n"
@@ -38,8 +40,8 @@ std::string getSampleUndirectedGraphMlContent()
            "    <node id=\"n4\"/>\n"
            "    <edge source=\"n0\" target=\"n1\"/>\n"
            "    <edge source=\"n1\" target=\"n0\"/>\n"
-           "    <edge source=\"n2\" target=\"n3\"/>\n"
-           "    <edge source=\"n3\" target=\"n2\"/>\n"
+           "    <edge source=\"n2\" target=\"n3\"><data key=\"weight\">5</data></edge>\n"
+           "    <edge source=\"n3\" target=\"n2\"><data key=\"weight\">5</data></edge>\n"
            "  </graph>\n"
            "</graphml>";
 }
@@ -64,8 +66,8 @@ std::tuple<std::string, GraphType> SerializationHelper<GraphType>::makeSampleGra
     graphRep.addNodes(5);
     graphRep.setEdge({.source = 1, .destination = 2});
     graphRep.setEdge({.source = 2, .destination = 1});
-    graphRep.setEdge({.source = 3, .destination = 4});
-    graphRep.setEdge({.source = 4, .destination = 3});
+    graphRep.setEdge({.source = 3, .destination = 4, .weight = 5});
+    graphRep.setEdge({.source = 4, .destination = 3, .weight = 5});
 
     return std::tie(streamContent, graphRep);
 }
@@ -1,4 +1,6 @@
+#include <cstring>
 #include <GraphRepresentationHelpers.hpp>
+#include <Graphs/SerializationFormats.hpp>
 #include <Graphs/Serializer.hpp>
 #include <gtest/gtest.h>
 #include <SerializationHelpers.hpp>
@@ -47,4 +49,28 @@ TYPED_TEST(SerializerTest, canSerializeGraphMlFiles)
 
     EXPECT_EQ(mockStream.str(), fileContent);
 }
+
+TYPED_TEST(SerializerTest, binarySnapshotHeaderDescribesGraph)
+{
+    auto [matContent, referenceGraph] = this->helper.makeSampleMatFile();
+    std::stringstream mockStream = {};
+
+    SerializerTest<TypeParam>::sut::serializeBinaryFile(mockStream, referenceGraph);
+
+    auto snapshot = mockStream.str();
+    ASSERT_GE(snapshot.size(), sizeof(BinaryFileHeader));
+    BinaryFileHeader header = {};
+    std::memcpy(&header, snapshot.data(), sizeof(header));
+    EXPECT_EQ(header.magic, BinaryFileHeader::expectedMagic);
+    EXPECT_EQ(header.version, BinaryFileHeader::currentVersion);
+    EXPECT_EQ(header.directionality, TypeParam::Directionality == GraphDirectionality::directed ? 1 : 0);
+    EXPECT_EQ(header.nodesCount, referenceGraph.nodesAmount());
+    uint64_t arcsCount = 0;
+    for (auto node : referenceGraph.getNodeIds())
+    {
+        arcsCount += referenceGraph.getOutgoingDegree(node);
+    }
+    EXPECT_EQ(header.edgesCount, arcsCount);
+    EXPECT_EQ(snapshot.size() % BinaryFileHeader::arraysAlignment, 0);
+}
 } // namespace Graphs
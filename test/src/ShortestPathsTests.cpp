@@ -0,0 +1,587 @@
+#include <gmock/gmock.h>
+#include <GraphRepresentationHelpers.hpp>
+#include <Graphs/CsrGraph.hpp>
+#include <Graphs/ShortestPaths.hpp>
+#include <gtest/gtest.h>
+#include <queue>
+#include <random>
+
+using namespace testing;
+
+namespace
+{
+constexpr Graphs::NodeId sourceNodeId = 1;
+
+constexpr std::array allQueueTypes = {Graphs::Algorithm::PriorityQueueType::binaryHeap,
+                                      Graphs::Algorithm::PriorityQueueType::pairingHeap,
+                                      Graphs::Algorithm::PriorityQueueType::radixHeap};
+} // namespace
+
+namespace Graphs::Algorithm
+{
+template <typename GraphType>
+class DijkstraTests : public testing::Test
+{
+protected:
+    ShortestPathsResult runDijkstra(const GraphType& graph, NodeId source, PriorityQueueType queueType)
+    {
+        auto result = std::make_shared<ShortestPathsResult>();
+        Dijkstra<notVerbose>{result, source, std::cout, queueType}(graph);
+        return *result;
+    }
+
+    // Shorter paths go through more edges, so the queue has to revise distances of queued nodes.
+    GraphType createWeightedGraph()
+    {
+        GraphType graph = {};
+        graph.addNodes(6);
+        graph.setEdges({
+            {1, 2, 7},
+            {1, 3, 2},
+            {3, 2, 3},
+            {2, 4, 1},
+            {3, 4, 8},
+            {4, 5, 2},
+            {3, 5, 9}
+        });
+        return graph;
+    }
+
+    GraphType createLargeRandomGraph()
+    {
+        return makeRandomGraph<GraphType>(1500, 1500 * 5, 5, {{1, 1000}});
+    }
+};
+
+TYPED_TEST_SUITE(DijkstraTests, GraphTypes);
+
+TYPED_TEST(DijkstraTests, constructorThrowsOnNullResult)
+{
+    EXPECT_THROW(Dijkstra<notVerbose>(nullptr, sourceNodeId), std::invalid_argument);
+}
+
+TYPED_TEST(DijkstraTests, missingSourceLeavesResultUntouched)
+{
+    auto [source, paths] = this->runDijkstra(this->createWeightedGraph(), 7, PriorityQueueType::binaryHeap);
+    EXPECT_EQ(source, noPredecessor);
+    EXPECT_TRUE(paths.empty());
+}
+
+TYPED_TEST(DijkstraTests, everyQueueFindsShortestPathsAndPredecessors)
+{
+    auto graph = this->createWeightedGraph();
+    for (auto queueType : allQueueTypes)
+    {
+        auto [source, paths] = this->runDijkstra(graph, sourceNodeId, queueType);
+
+        EXPECT_EQ(source, sourceNodeId);
+        EXPECT_THAT(paths,
+                    ElementsAre(PathInfo{1, 0, noPredecessor},
+                                PathInfo{2, 5, 3},
+                                PathInfo{3, 2, 1},
+                                PathInfo{4, 6, 2},
+                                PathInfo{5, 8, 4},
+                                PathInfo{6, unreachable, noPredecessor}));
+    }
+}
+
+TYPED_TEST(DijkstraTests, negativeWeightIsRejected)
+{
+    auto graph = this->createWeightedGraph();
+    graph.setEdge({sourceNodeId, 6, -1});
+
+    for (auto queueType : allQueueTypes)
+    {
+        EXPECT_THROW(this->runDijkstra(graph, sourceNodeId, queueType), std::invalid_argument);
+    }
+}
+
+TYPED_TEST(DijkstraTests, queuesAgreeOnDistancesInLargeGraph)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto [_, expectedPaths] = this->runDijkstra(graph, sourceNodeId, PriorityQueueType::binaryHeap);
+
+    for (auto queueType : {PriorityQueueType::pairingHeap, PriorityQueueType::radixHeap})
+    {
+        auto [source, paths] = this->runDijkstra(graph, sourceNodeId, queueType);
+        ASSERT_EQ(paths.size(), expectedPaths.size());
+        for (std::size_t position = 0; position < paths.size(); position++)
+        {
+            auto [node, distance, predecessor] = paths[position];
+            EXPECT_EQ(distance, std::get<Distance>(expectedPaths[position]));
+            if (predecessor != noPredecessor)
+            {
+                auto predecessorDistance = std::get<Distance>(paths[predecessor - 1]);
+                EXPECT_EQ(distance, predecessorDistance + *graph.findEdge({predecessor, node}).weight);
+            }
+        }
+    }
+}
+
+template <typename GraphType>
+class BellmanFordTests : public DijkstraTests<GraphType>
+{
+protected:
+    std::pair<ShortestPathsResult, NegativeCycle> runBellmanFord(const GraphType& graph,
+                                                                  RelaxationMode mode,
+                                                                  uint32_t threadsCount = 4)
+    {
+        auto result = std::make_shared<ShortestPathsResult>();
+        auto cycle = std::make_shared<NegativeCycle>();
+        BellmanFord<notVerbose>{result, cycle, sourceNodeId, std::cout, mode, threadsCount}(graph);
+        return {*result, *cycle};
+    }
+
+    // Distances of the nodes in ascending order of ids.
+    static std::vector<Distance> distancesOf(const ShortestPathsResult& result)
+    {
+        std::vector<Distance> distances = {};
+        for (const auto& path : std::get<ShortestPathsVector>(result))
+        {
+            distances.push_back(std::get<Distance>(path));
+        }
+        return distances;
+    }
+};
+
+TYPED_TEST_SUITE(BellmanFordTests, GraphTypes);
+
+TYPED_TEST(BellmanFordTests, constructorThrowsOnNullContainers)
+{
+    EXPECT_THROW(BellmanFord<notVerbose>(std::make_shared<ShortestPathsResult>(), nullptr, sourceNodeId),
+                 std::invalid_argument);
+    EXPECT_THROW(BellmanFord<notVerbose>(nullptr, std::make_shared<NegativeCycle>(), sourceNodeId),
+                 std::invalid_argument);
+}
+
+TYPED_TEST(BellmanFordTests, bothModesMatchDijkstraForNonNegativeWeights)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto expected = this->runDijkstra(graph, sourceNodeId, PriorityQueueType::binaryHeap);
+
+    for (auto mode : {RelaxationMode::queue, RelaxationMode::parallelRounds})
+    {
+        auto [result, cycle] = this->runBellmanFord(graph, mode);
+        EXPECT_TRUE(cycle.empty());
+        EXPECT_EQ(this->distancesOf(result), this->distancesOf(expected));
+    }
+}
+
+TYPED_TEST(BellmanFordTests, negativeEdgeOfUndirectedGraphFormsCycle)
+{
+    if constexpr (TypeParam::Directionality == GraphDirectionality::undirected)
+    {
+        auto graph = this->createWeightedGraph();
+        graph.setEdge({3, 4, -1});
+
+        for (auto mode : {RelaxationMode::queue, RelaxationMode::parallelRounds})
+        {
+            auto [result, cycle] = this->runBellmanFord(graph, mode);
+            EXPECT_THAT(cycle, ElementsAre(3, 4));
+            EXPECT_TRUE(std::get<ShortestPathsVector>(result).empty());
+        }
+    }
+}
+
+template <typename GraphType>
+using DirectedBellmanFordTests = BellmanFordTests<GraphType>;
+
+TYPED_TEST_SUITE(DirectedBellmanFordTests, DirectedGraphTypes);
+
+TYPED_TEST(DirectedBellmanFordTests, negativeWeightsShortenPaths)
+{
+    TypeParam graph = {};
+    graph.addNodes(4);
+    graph.setEdges({
+        {1, 2,  4},
+        {1, 3,  5},
+        {3, 2, -3},
+        {2, 4,  2}
+    });
+
+    for (auto mode : {RelaxationMode::queue, RelaxationMode::parallelRounds})
+    {
+        auto [result, cycle] = this->runBellmanFord(graph, mode);
+        EXPECT_TRUE(cycle.empty());
+        EXPECT_THAT(std::get<ShortestPathsVector>(result),
+                    ElementsAre(PathInfo{1, 0, noPredecessor},
+                                PathInfo{2, 2, 3},
+                                PathInfo{3, 5, 1},
+                                PathInfo{4, 4, 2}));
+    }
+}
+
+TYPED_TEST(DirectedBellmanFordTests, reachableNegativeCycleIsReturned)
+{
+    TypeParam graph = {};
+    graph.addNodes(5);
+    graph.setEdges({
+        {1, 2,  1},
+        {2, 3, -2},
+        {3, 4, -1},
+        {4, 2,  1},
+        {4, 5,  1}
+    });
+
+    for (auto mode : {RelaxationMode::queue, RelaxationMode::parallelRounds})
+    {
+        auto [result, cycle] = this->runBellmanFord(graph, mode);
+        EXPECT_THAT(cycle, ElementsAre(2, 3, 4));
+        EXPECT_TRUE(std::get<ShortestPathsVector>(result).empty());
+    }
+}
+
+TYPED_TEST(DirectedBellmanFordTests, unreachableNegativeCycleIsIgnored)
+{
+    TypeParam graph = {};
+    graph.addNodes(4);
+    graph.setEdges({
+        {1, 2,  3},
+        {3, 4, -2},
+        {4, 3,  1}
+    });
+
+    for (auto mode : {RelaxationMode::queue, RelaxationMode::parallelRounds})
+    {
+        auto [result, cycle] = this->runBellmanFord(graph, mode);
+        EXPECT_TRUE(cycle.empty());
+        EXPECT_THAT(this->distancesOf(result), ElementsAre(0, 3, unreachable, unreachable));
+    }
+}
+
+TYPED_TEST(DirectedBellmanFordTests, modesAgreeOnAcyclicGraphWithNegativeWeights)
+{
+    constexpr uint32_t nodesCount = 800;
+    TypeParam graph = {};
+    graph.addNodes(nodesCount);
+    std::mt19937 generator{3};
+    std::uniform_int_distribution<NodeId> nodes{1, nodesCount};
+    std::uniform_int_distribution<WeightType> weights{-50, 100};
+    for (uint32_t i = 0; i < nodesCount * 5; i++)
+    {
+        auto source = nodes(generator);
+        auto destination = nodes(generator);
+        auto weight = weights(generator);
+        if (source != destination)
+        {
+            graph.setEdge({std::min(source, destination), std::max(source, destination), weight != 0 ? weight : 1});
+        }
+    }
+
+    auto [queueResult, queueCycle] = this->runBellmanFord(graph, RelaxationMode::queue);
+    auto [roundsResult, roundsCycle] = this->runBellmanFord(graph, RelaxationMode::parallelRounds, 8);
+    EXPECT_TRUE(queueCycle.empty());
+    EXPECT_TRUE(roundsCycle.empty());
+    EXPECT_EQ(this->distancesOf(queueResult), this->distancesOf(roundsResult));
+}
+
+template <typename GraphType>
+class DeltaSteppingTests : public DijkstraTests<GraphType>
+{
+protected:
+    ShortestPathsResult runDeltaStepping(const GraphType& graph, Distance delta, uint32_t threadsCount)
+    {
+        auto result = std::make_shared<ShortestPathsResult>();
+        DeltaStepping<notVerbose>{result, sourceNodeId, std::cout, delta, threadsCount}(graph);
+        return *result;
+    }
+};
+
+TYPED_TEST_SUITE(DeltaSteppingTests, GraphTypes);
+
+TYPED_TEST(DeltaSteppingTests, constructorThrowsOnNullResultOrNegativeDelta)
+{
+    EXPECT_THROW(DeltaStepping<notVerbose>(nullptr, sourceNodeId), std::invalid_argument);
+    EXPECT_THROW(DeltaStepping<notVerbose>(std::make_shared<ShortestPathsResult>(), sourceNodeId, std::cout, -1),
+                 std::invalid_argument);
+}
+
+TYPED_TEST(DeltaSteppingTests, deltaSteppingFindsShortestPathsAndPredecessors)
+{
+    auto [source, paths] = this->runDeltaStepping(this->createWeightedGraph(), 3, 4);
+
+    EXPECT_EQ(source, sourceNodeId);
+    EXPECT_THAT(paths,
+                ElementsAre(PathInfo{1, 0, noPredecessor},
+                            PathInfo{2, 5, 3},
+                            PathInfo{3, 2, 1},
+                            PathInfo{4, 6, 2},
+                            PathInfo{5, 8, 4},
+                            PathInfo{6, unreachable, noPredecessor}));
+}
+
+TYPED_TEST(DeltaSteppingTests, negativeWeightIsRejected)
+{
+    auto graph = this->createWeightedGraph();
+    graph.setEdge({sourceNodeId, 6, -1});
+
+    EXPECT_THROW(this->runDeltaStepping(graph, 0, 2), std::invalid_argument);
+}
+
+TYPED_TEST(DeltaSteppingTests, deltaSteppingMatchesDijkstraForAnyDelta)
+{
+    auto graph = this->createLargeRandomGraph();
+    auto [_, expectedPaths] = this->runDijkstra(graph, sourceNodeId, PriorityQueueType::binaryHeap);
+
+    for (Distance delta : {0, 1, 100, 100000})
+    {
+        auto [source, paths] = this->runDeltaStepping(graph, delta, 8);
+        ASSERT_EQ(paths.size(), expectedPaths.size());
+        for (std::size_t position = 0; position < paths.size(); position++)
+        {
+            auto [node, distance, predecessor] = paths[position];
+            EXPECT_EQ(distance, std::get<Distance>(expectedPaths[position]));
+            if (predecessor != noPredecessor)
+            {
+                auto predecessorDistance = std::get<Distance>(paths[predecessor - 1]);
+                EXPECT_EQ(distance, predecessorDistance + *graph.findEdge({predecessor, node}).weight);
+            }
+        }
+    }
+}
+
+template <typename GraphType>
+class FloydWarshallTests : public DijkstraTests<GraphType>
+{
+protected:
+    DistanceMatrix runFloydWarshall(const GraphType& graph, bool reconstructPaths = true, uint32_t threadsCount = 4)
+    {
+        auto result = std::make_shared<DistanceMatrix>();
+        FloydWarshall<notVerbose>{result, std::cout, reconstructPaths, threadsCount}(graph);
+        return *result;
+    }
+
+    // Spans several tiles, the last one only partially filled.
+    GraphType createRandomGraph()
+    {
+        return makeRandomGraph<GraphType>(150, 150 * 3, 11, {{1, 1000}});
+    }
+
+    void expectPathOfLength(const GraphType& graph, const std::vector<NodeId>& path, Distance length)
+    {
+        ASSERT_FALSE(path.empty());
+        Distance pathLength = 0;
+        for (std::size_t position = 1; position < path.size(); position++)
+        {
+            pathLength += *graph.findEdge({path[position - 1], path[position]}).weight;
+        }
+        EXPECT_EQ(pathLength, length);
+    }
+};
+
+TYPED_TEST_SUITE(FloydWarshallTests, GraphTypes);
+
+TYPED_TEST(FloydWarshallTests, constructorThrowsOnNullResult)
+{
+    EXPECT_THROW(FloydWarshall<notVerbose>(nullptr), std::invalid_argument);
+}
+
+TYPED_TEST(FloydWarshallTests, emptyGraphGivesEmptyMatrix)
+{
+    auto matrix = this->runFloydWarshall(TypeParam{});
+    EXPECT_TRUE(matrix.nodes.empty());
+    EXPECT_TRUE(matrix.distances.empty());
+    EXPECT_EQ(matrix.distance(1, 1), unreachable);
+}
+
+TYPED_TEST(FloydWarshallTests, distancesAndPathsOfSmallGraph)
+{
+    auto graph = this->createWeightedGraph();
+    auto matrix = this->runFloydWarshall(graph);
+
+    EXPECT_THAT(matrix.nodes, ElementsAre(1, 2, 3, 4, 5, 6));
+    EXPECT_EQ(matrix.distance(1, 1), 0);
+    EXPECT_EQ(matrix.distance(1, 5), 8);
+    EXPECT_EQ(matrix.distance(1, 6), unreachable);
+    EXPECT_EQ(matrix.distance(1, 7), unreachable);
+    EXPECT_THAT(matrix.path(1, 5), ElementsAre(1, 3, 2, 4, 5));
+    EXPECT_THAT(matrix.path(3, 3), ElementsAre(3));
+    EXPECT_TRUE(matrix.path(6, 1).empty());
+}
+
+TYPED_TEST(FloydWarshallTests, pathsAreOnlyKeptOnRequest)
+{
+    auto matrix = this->runFloydWarshall(this->createWeightedGraph(), false);
+
+    EXPECT_EQ(matrix.distance(1, 5), 8);
+    EXPECT_TRUE(matrix.nextHops.empty());
+    EXPECT_TRUE(matrix.path(1, 5).empty());
+}
+
+TYPED_TEST(FloydWarshallTests, floydWarshallMatchesDijkstraFromEverySource)
+{
+    auto graph = this->createRandomGraph();
+    auto matrix = this->runFloydWarshall(graph, true, 8);
+    auto singleThreaded = this->runFloydWarshall(graph, false, 1);
+    EXPECT_EQ(singleThreaded.distances, matrix.distances);
+
+    for (auto source : graph.getNodeIds())
+    {
+        auto [_, paths] = this->runDijkstra(graph, source, PriorityQueueType::binaryHeap);
+        for (const auto& [destination, distance, predecessor] : paths)
+        {
+            EXPECT_EQ(matrix.distance(source, destination), distance);
+            if (distance != unreachable)
+            {
+                auto path = matrix.path(source, destination);
+                this->expectPathOfLength(graph, path, distance);
+                EXPECT_EQ(path.back(), destination);
+            }
+        }
+    }
+}
+
+template <typename GraphType>
+using DirectedFloydWarshallTests = FloydWarshallTests<GraphType>;
+
+TYPED_TEST_SUITE(DirectedFloydWarshallTests, DirectedGraphTypes);
+
+TYPED_TEST(DirectedFloydWarshallTests, negativeWeightsShortenPaths)
+{
+    TypeParam graph = {};
+    graph.addNodes(4);
+    graph.setEdges({
+        {1, 2,  4},
+        {1, 3,  5},
+        {3, 2, -3},
+        {2, 4,  2}
+    });
+
+    auto matrix = this->runFloydWarshall(graph);
+    EXPECT_EQ(matrix.distance(1, 4), 4);
+    EXPECT_EQ(matrix.distance(3, 4), -1);
+    EXPECT_EQ(matrix.distance(4, 1), unreachable);
+    EXPECT_THAT(matrix.path(1, 4), ElementsAre(1, 3, 2, 4));
+}
+
+TYPED_TEST(DirectedFloydWarshallTests, negativeCycleClearsResultOfPreviousRun)
+{
+    TypeParam graph = {};
+    graph.addNodes(4);
+    graph.setEdges({
+        {1, 2,  3},
+        {3, 4, -2}
+    });
+    auto result = std::make_shared<DistanceMatrix>();
+    FloydWarshall<notVerbose> floydWarshall{result, std::cout, true, 4};
+    floydWarshall(graph);
+    ASSERT_EQ(result->distance(3, 4), -2);
+
+    graph.setEdge({4, 3, 1});
+    floydWarshall(graph);
+    EXPECT_TRUE(result->nodes.empty());
+    EXPECT_TRUE(result->distances.empty());
+    EXPECT_TRUE(result->nextHops.empty());
+}
+
+template <typename GraphType>
+class MultiSourceBfsTests : public FloydWarshallTests<GraphType>
+{
+protected:
+    HopMatrix runMultiSourceBfs(const GraphReader& graph, std::vector<NodeId> sources, uint32_t threadsCount = 4)
+    {
+        auto result = std::make_shared<HopMatrix>();
+        MultiSourceBfs<notVerbose>{result, std::move(sources), std::cout, threadsCount}(graph);
+        return *result;
+    }
+
+    // Hop counts from the source to the nodes in ascending order of ids, by a plain queue-based BFS.
+    static std::vector<HopCount> searchFrom(const GraphReader& graph, NodeId source)
+    {
+        auto ids = graph.getNodeIds();
+        std::vector<HopCount> hops(ids.back() + 1, unreachableHops);
+        std::queue<NodeId> queue = {};
+        hops[source] = 0;
+        queue.push(source);
+        while (not queue.empty())
+        {
+            auto node = queue.front();
+            queue.pop();
+            for (auto neighbor : graph.getOutgoingNeighborsOf(node))
+            {
+                if (hops[neighbor] == unreachableHops)
+                {
+                    hops[neighbor] = hops[node] + 1;
+                    queue.push(neighbor);
+                }
+            }
+        }
+
+        std::vector<HopCount> hopsByIndex = {};
+        for (auto id : ids)
+        {
+            hopsByIndex.push_back(hops[id]);
+        }
+        return hopsByIndex;
+    }
+
+    void expectHopsOfEverySource(const GraphReader& graph, const HopMatrix& matrix)
+    {
+        ASSERT_EQ(matrix.hops.size(), matrix.sources.size() * matrix.nodes.size());
+        for (std::size_t row = 0; row < matrix.sources.size(); row++)
+        {
+            std::vector<HopCount> hops(matrix.hops.begin() + row * matrix.nodes.size(),
+                                       matrix.hops.begin() + (row + 1) * matrix.nodes.size());
+            EXPECT_EQ(hops, searchFrom(graph, matrix.sources[row]));
+        }
+    }
+};
+
+TYPED_TEST_SUITE(MultiSourceBfsTests, GraphTypes);
+
+TYPED_TEST(MultiSourceBfsTests, constructorThrowsOnNullResult)
+{
+    EXPECT_THROW(MultiSourceBfs<notVerbose>(nullptr), std::invalid_argument);
+}
+
+TYPED_TEST(MultiSourceBfsTests, missingSourceLeavesResultUntouched)
+{
+    auto matrix = this->runMultiSourceBfs(this->createWeightedGraph(), {1, 7});
+    EXPECT_TRUE(matrix.sources.empty());
+    EXPECT_TRUE(matrix.hops.empty());
+}
+
+TYPED_TEST(MultiSourceBfsTests, hopsIgnoreWeights)
+{
+    auto matrix = this->runMultiSourceBfs(this->createWeightedGraph(), {1, 3});
+
+    EXPECT_THAT(matrix.sources, ElementsAre(1, 3));
+    EXPECT_THAT(matrix.nodes, ElementsAre(1, 2, 3, 4, 5, 6));
+    EXPECT_EQ(matrix.hopsBetween(1, 4), 2);
+    EXPECT_EQ(matrix.hopsBetween(1, 5), 2);
+    EXPECT_EQ(matrix.hopsBetween(3, 3), 0);
+    EXPECT_EQ(matrix.hopsBetween(3, 6), unreachableHops);
+    EXPECT_EQ(matrix.hopsBetween(2, 1), unreachableHops);
+    this->expectHopsOfEverySource(this->createWeightedGraph(), matrix);
+}
+
+TYPED_TEST(MultiSourceBfsTests, noSourcesSearchesFromEveryNode)
+{
+    auto graph = this->createRandomGraph();
+    auto matrix = this->runMultiSourceBfs(graph, {});
+
+    EXPECT_EQ(matrix.sources, graph.getNodeIds());
+    this->expectHopsOfEverySource(graph, matrix);
+}
+
+TYPED_TEST(MultiSourceBfsTests, batchesMatchSingleSearchesOnGraphAndItsCsrCopy)
+{
+    auto graph = this->createRandomGraph();
+    CsrGraph<TypeParam::Directionality> csrGraph(graph);
+    std::vector<NodeId> sources = {};
+    for (uint32_t repetition = 0; repetition < 3; repetition++)
+    {
+        for (auto node : graph.getNodeIds())
+        {
+            sources.push_back(node);
+        }
+    }
+
+    for (uint32_t sourcesCount : {1u, 64u, 65u, 256u, 450u})
+    {
+        std::vector<NodeId> batch(sources.begin(), sources.begin() + sourcesCount);
+        this->expectHopsOfEverySource(graph, this->runMultiSourceBfs(graph, batch, 8));
+        EXPECT_EQ(this->runMultiSourceBfs(csrGraph, batch, 1).hops, this->runMultiSourceBfs(graph, batch, 8).hops);
+    }
+}
+} // namespace Graphs::Algorithm
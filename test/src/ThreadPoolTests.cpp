@@ -0,0 +1,62 @@
+#include <atomic>
+#include <Graphs/ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace Graphs
+{
+TEST(ThreadPoolTests, poolAlwaysHasAtLeastTheCallingThread)
+{
+    ThreadPool sut(0);
+    EXPECT_EQ(sut.size(), 1);
+}
+
+TEST(ThreadPoolTests, parallelForVisitsEveryIndexExactlyOnce)
+{
+    constexpr uint32_t count = 10007;
+    ThreadPool sut(4);
+    std::vector<std::atomic<uint32_t>> visits(count);
+
+    sut.parallelFor(count, [&visits](uint32_t begin, uint32_t end) {
+        for (auto index = begin; index < end; index++)
+        {
+            ++visits[index];
+        }
+    });
+
+    for (const auto& visitCount : visits)
+    {
+        EXPECT_EQ(visitCount, 1);
+    }
+}
+
+TEST(ThreadPoolTests, parallelForOverEmptyRangeDoesNotCallTheBody)
+{
+    ThreadPool sut(4);
+    bool called = false;
+    sut.parallelFor(0, [&called](uint32_t, uint32_t) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+}
+
+TEST(ThreadPoolTests, exceptionThrownByBodyIsRethrownInCallingThread)
+{
+    ThreadPool sut(4);
+    EXPECT_THROW(sut.parallelFor(100,
+                                 [](uint32_t begin, uint32_t) {
+                                     if (begin == 0)
+                                     {
+                                         throw std::runtime_error("failure");
+                                     }
+                                 }),
+                 std::runtime_error);
+
+    std::atomic<uint32_t> processed = 0;
+    sut.parallelFor(100, [&processed](uint32_t begin, uint32_t end) {
+        processed += end - begin;
+    });
+    EXPECT_EQ(processed, 100);
+}
+} // namespace Graphs